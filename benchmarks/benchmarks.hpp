@@ -0,0 +1,152 @@
+#ifndef BENCHMARKS_HPP
+#define BENCHMARKS_HPP
+
+#include <sys/time.h>
+#include <cstddef>
+#include <iostream>
+#include <memory>
+
+namespace benchmarks
+{
+	inline unsigned long long get_time()
+	{
+		struct timeval	timeval;
+
+		gettimeofday(&timeval, NULL);
+		return timeval.tv_sec * 1000000ULL + timeval.tv_usec;
+	}
+
+	inline void print_duration(char const* name, unsigned long long time_start)
+	{
+		std::cout << "- " << name << " : " << get_time() - time_start
+			<< " microseconds" << std::endl;
+	}
+
+	template <class Dummy>
+	struct allocation_counter
+	{
+		static std::size_t bytes;
+		static std::size_t allocations;
+	};
+
+	template <class Dummy>
+	std::size_t allocation_counter<Dummy>::bytes = 0;
+
+	template <class Dummy>
+	std::size_t allocation_counter<Dummy>::allocations = 0;
+
+	typedef allocation_counter<void> allocation_stats;
+
+	template <class T>
+	class counting_allocator : public std::allocator<T>
+	{
+	public:
+		typedef typename std::allocator<T>::pointer pointer;
+		typedef typename std::allocator<T>::size_type size_type;
+
+		template <class U>
+		struct rebind
+		{
+			typedef counting_allocator<U> other;
+		};
+
+		counting_allocator()
+		{
+			return;
+		}
+
+		counting_allocator(counting_allocator const& src) :
+			std::allocator<T>(src)
+		{
+			return;
+		}
+
+		template <class U>
+		counting_allocator(counting_allocator<U> const& src) :
+			std::allocator<T>(src)
+		{
+			return;
+		}
+
+		pointer allocate(size_type n, void const* hint = 0)
+		{
+			static_cast<void>(hint);
+			allocation_stats::bytes += n * sizeof(T);
+			allocation_stats::allocations++;
+			return std::allocator<T>::allocate(n);
+		}
+
+		void deallocate(pointer p, size_type n)
+		{
+			allocation_stats::bytes -= n * sizeof(T);
+			std::allocator<T>::deallocate(p, n);
+		}
+	};
+
+	namespace rbt_node
+	{
+		void launch();
+	}
+
+	namespace btree
+	{
+		void launch();
+	}
+
+	namespace hinted_insert
+	{
+		void launch();
+	}
+
+	namespace sharded_map
+	{
+		void launch();
+	}
+
+	namespace unordered_map
+	{
+		void launch();
+	}
+
+	namespace rb_tree
+	{
+		void launch();
+	}
+
+	namespace range_scan
+	{
+		void launch();
+	}
+
+	namespace compare
+	{
+		void launch();
+	}
+
+	namespace concurrent_stack
+	{
+		void launch();
+	}
+
+	namespace stack
+	{
+		void launch();
+	}
+
+	namespace reverse_range
+	{
+		void launch();
+	}
+
+	namespace string_growth
+	{
+		void launch();
+	}
+
+	namespace emplace
+	{
+		void launch();
+	}
+}
+
+#endif
@@ -0,0 +1,79 @@
+#include "map.hpp"
+#include "btree_map.hpp"
+#include "benchmarks.hpp"
+
+namespace benchmarks { namespace btree
+{
+	std::size_t const nb_elems = 1000000;
+
+	int shuffled_key(std::size_t i)
+	{
+		return static_cast<int>((i * 2654435761UL) % nb_elems);
+	}
+
+	template <class Map>
+	void run(char const* name)
+	{
+		std::cout << name << " :\n";
+		std::size_t bytes_start = allocation_stats::bytes;
+		unsigned long long time_start = get_time();
+		Map map;
+		for (std::size_t i = 0; i < nb_elems; ++i) {
+			map.insert(typename Map::value_type(shuffled_key(i), i));
+		}
+		print_duration("random insert", time_start);
+		std::size_t bytes = allocation_stats::bytes - bytes_start;
+		std::cout << "- memory : " << bytes << " bytes, "
+			<< static_cast<double>(bytes) / map.size() << " bytes per elem"
+			<< std::endl;
+
+		long long sum = 0;
+		time_start = get_time();
+		for (std::size_t i = 0; i < nb_elems; ++i) {
+			sum += map.find(shuffled_key(i * 31))->second;
+		}
+		print_duration("random find", time_start);
+
+		time_start = get_time();
+		for (std::size_t i = 0; i < nb_elems; ++i) {
+			sum += map.lower_bound(shuffled_key(i) + 1) != map.end();
+		}
+		print_duration("random lower_bound", time_start);
+
+		time_start = get_time();
+		for (int round = 0; round < 10; ++round) {
+			for (typename Map::const_iterator cit = map.begin(),
+					cite = map.end(); cit != cite; ++cit) {
+				sum += cit->second;
+			}
+		}
+		print_duration("10 full range scans", time_start);
+
+		time_start = get_time();
+		for (std::size_t i = 0; i < nb_elems; i += 2) {
+			map.erase(shuffled_key(i));
+		}
+		print_duration("erase half", time_start);
+
+		Map sequential;
+		time_start = get_time();
+		for (std::size_t i = 0; i < nb_elems; ++i) {
+			sequential.insert(sequential.end(),
+					typename Map::value_type(static_cast<int>(i), i));
+		}
+		print_duration("sequential insert", time_start);
+		std::cout << "- checksum : " << sum << std::endl;
+	}
+
+	void launch()
+	{
+		std::cout << "btree_map against map, " << nb_elems
+			<< " int keys\n\n";
+		run< ft::map<int, long, ft::less<int>,
+			counting_allocator< ft::pair<int const, long> > > >("ft::map");
+		std::cout << "\n";
+		run< ft::btree_map<int, long, ft::less<int>,
+			counting_allocator< ft::pair<int const, long> > > >("ft::btree_map");
+		std::cout << std::flush;
+	}
+} }
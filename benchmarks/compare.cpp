@@ -0,0 +1,61 @@
+#include <cstddef>
+
+#include "vector.hpp"
+#include "equal_to.hpp"
+#include "less.hpp"
+#include "benchmarks.hpp"
+
+namespace benchmarks { namespace compare
+{
+	// Each size is compared until this many bytes went through.
+	std::size_t const bytes_per_size = 256 * 1024 * 1024;
+
+	template <class T>
+	void measure(char const* type_name, std::size_t size)
+	{
+		// Equal but for the last element, so every byte is read.
+		ft::vector<T> lhs(size, 1);
+		ft::vector<T> rhs(lhs);
+		rhs.back() = 2;
+		std::size_t rounds = bytes_per_size / size;
+		int found = 0;
+
+		std::cout << "  " << type_name << ", " << size << " bytes, " << rounds
+			<< " rounds :\n";
+		unsigned long long time_start = get_time();
+		for (std::size_t i = 0; i < rounds; ++i) {
+			found += ft::equal(lhs.begin(), lhs.end(), rhs.begin(),
+					ft::equal_to<T>());
+		}
+		print_duration("  equal, element loop", time_start);
+		time_start = get_time();
+		for (std::size_t i = 0; i < rounds; ++i) {
+			found += (lhs == rhs);
+		}
+		print_duration("  operator==, memcmp", time_start);
+		time_start = get_time();
+		for (std::size_t i = 0; i < rounds; ++i) {
+			found += ft::lexicographical_compare(lhs.begin(), lhs.end(),
+					rhs.begin(), rhs.end(), ft::less<T>());
+		}
+		print_duration("  lexicographical_compare, element loop", time_start);
+		time_start = get_time();
+		for (std::size_t i = 0; i < rounds; ++i) {
+			found += (lhs < rhs);
+		}
+		print_duration("  operator<, contiguous kernel", time_start);
+		std::cout << "    checksum : " << found << std::endl;
+	}
+
+	void launch()
+	{
+		std::size_t const sizes[] = { 1024, 64 * 1024, 1024 * 1024,
+			64 * 1024 * 1024 };
+
+		std::cout << "Comparisons of vectors differing on their last byte\n";
+		for (int i = 0; i < 4; ++i) {
+			measure<unsigned char>("unsigned char", sizes[i]);
+			measure<char>("char", sizes[i]);
+		}
+	}
+} }
@@ -0,0 +1,128 @@
+#include <pthread.h>
+
+#include "stack.hpp"
+#include "concurrent_stack.hpp"
+#include "benchmarks.hpp"
+
+namespace benchmarks { namespace concurrent_stack
+{
+	long const nb_ops = 4000000;
+
+	// ft::stack behind a mutex, the baseline of the lock-free stack
+	class locked_stack
+	{
+	public:
+		locked_stack()
+		{
+			pthread_mutex_init(&this->mutex_, NULL);
+			return;
+		}
+
+		~locked_stack()
+		{
+			pthread_mutex_destroy(&this->mutex_);
+			return;
+		}
+
+		void push(long val)
+		{
+			pthread_mutex_lock(&this->mutex_);
+			this->stack_.push(val);
+			pthread_mutex_unlock(&this->mutex_);
+			return;
+		}
+
+		bool try_pop(long& val)
+		{
+			pthread_mutex_lock(&this->mutex_);
+			bool popped = this->stack_.empty() == false;
+			if (popped == true) {
+				val = this->stack_.top();
+				this->stack_.pop();
+			}
+			pthread_mutex_unlock(&this->mutex_);
+			return popped;
+		}
+
+	private:
+		pthread_mutex_t mutex_;
+		ft::stack<long> stack_;
+	};
+
+	template <class Stack>
+	struct worker_arg
+	{
+		Stack* stack;
+		long ops;
+		long checksum;
+	};
+
+	// pushes two values for one pop, the work distribution pattern
+	template <class Stack>
+	void* worker(void* arg)
+	{
+		worker_arg<Stack>* warg = static_cast<worker_arg<Stack>*>(arg);
+		long checksum = 0;
+		for (long i = 0; i < warg->ops; i += 3) {
+			warg->stack->push(i);
+			warg->stack->push(i + 1);
+			long val = 0;
+			if (warg->stack->try_pop(val) == true) {
+				checksum += val;
+			}
+		}
+		warg->checksum = checksum;
+		return NULL;
+	}
+
+	template <class Stack>
+	void run(char const* name, int nb_threads)
+	{
+		Stack stack;
+		pthread_t threads[32];
+		worker_arg<Stack> args[32];
+		unsigned long long time_start = get_time();
+		int started = 0;
+		for (int i = 0; i < nb_threads; ++i) {
+			args[i].stack = &stack;
+			args[i].ops = nb_ops / nb_threads;
+			args[i].checksum = 0;
+			if (pthread_create(&threads[i], NULL, &worker<Stack>, &args[i])
+					!= 0) {
+				break;
+			}
+			started++;
+		}
+		for (int i = started; i < nb_threads; ++i) {
+			worker<Stack>(&args[i]);
+		}
+		long checksum = 0;
+		for (int i = 0; i < nb_threads; ++i) {
+			if (i < started) {
+				pthread_join(threads[i], NULL);
+			}
+			checksum += args[i].checksum;
+		}
+		unsigned long long duration = get_time() - time_start;
+		if (duration == 0) {
+			duration = 1;
+		}
+		std::cout << "- " << name << ", " << nb_threads << " threads : "
+			<< nb_ops * 1000ULL / duration << " ops/ms, checksum "
+			<< checksum << std::endl;
+	}
+
+	void launch()
+	{
+		std::cout << "ft::concurrent_stack against a mutex ft::stack, "
+			<< nb_ops << " ops, 2 push for 1 try_pop\n\n";
+		int const thread_counts[] = { 1, 2, 4, 8, 16 };
+		for (std::size_t i = 0; i < sizeof(thread_counts)
+				/ sizeof(*thread_counts); ++i) {
+			run<locked_stack>("mutex ft::stack", thread_counts[i]);
+			run< ft::concurrent_stack<long> >("ft::concurrent_stack",
+					thread_counts[i]);
+		}
+		std::cout << std::flush;
+	}
+} }
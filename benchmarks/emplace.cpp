@@ -0,0 +1,62 @@
+#include <string>
+
+#include "map.hpp"
+#include "benchmarks.hpp"
+
+namespace benchmarks { namespace emplace
+{
+	int const nb_elems = 20000;
+	int const nb_rounds = 50;
+
+	typedef ft::map<int, std::string, std::less<int>,
+		counting_allocator< ft::pair<int const, std::string> > > map_type;
+
+	// Every key is inserted twice, the second time is a duplicate.
+	template <class Insert>
+	void run(char const* name, Insert insert)
+	{
+		std::string const word(40, 'x');
+		std::size_t allocations_start = allocation_stats::allocations;
+		unsigned long long time_start = get_time();
+		std::size_t size = 0;
+		for (int round = 0; round < nb_rounds; ++round) {
+			map_type map;
+			for (int i = 0; i < nb_elems * 2; ++i) {
+				insert(map, static_cast<int>(i * 7919LL % nb_elems), word);
+			}
+			size += map.size();
+		}
+		print_duration(name, time_start);
+		std::cout << "  " << size << " elements, "
+			<< allocation_stats::allocations - allocations_start
+			<< " node allocations" << std::endl;
+	}
+
+	void insert_value(map_type& map, int k, std::string const& word)
+	{
+		map.insert(map_type::value_type(k, word));
+		return;
+	}
+
+	void emplace_key(map_type& map, int k, std::string const& word)
+	{
+		map.emplace(k, word);
+		return;
+	}
+
+	void emplace_hint_end(map_type& map, int k, std::string const& word)
+	{
+		map.emplace_hint(map.end(), k, word);
+		return;
+	}
+
+	void launch()
+	{
+		std::cout << "ft::map<int, std::string> of " << nb_elems
+			<< " keys, each inserted twice, 40 chars values, " << nb_rounds
+			<< " rounds\n";
+		run("insert of a value_type", &insert_value);
+		run("emplace of a key and a mapped value", &emplace_key);
+		run("emplace_hint at end()", &emplace_hint_end);
+	}
+} }
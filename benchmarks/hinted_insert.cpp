@@ -0,0 +1,58 @@
+#include <map>
+
+#include "map.hpp"
+#include "benchmarks.hpp"
+
+namespace benchmarks { namespace hinted_insert
+{
+	std::size_t const nb_elems = 10000000;
+
+	template <class Map>
+	void run(char const* name)
+	{
+		std::cout << name << " :\n";
+		long long sum = 0;
+		{
+			Map map;
+			unsigned long long time_start = get_time();
+			for (std::size_t i = 0; i < nb_elems; ++i) {
+				map.insert(map.end(),
+						typename Map::value_type(static_cast<long>(i), i));
+			}
+			print_duration("end() hinted monotone insert", time_start);
+			sum += map.size();
+		}
+		{
+			Map map;
+			typename Map::iterator hint = map.end();
+			unsigned long long time_start = get_time();
+			for (std::size_t i = 0; i < nb_elems; ++i) {
+				hint = map.insert(hint,
+						typename Map::value_type(static_cast<long>(i), i));
+			}
+			print_duration("previous element hinted monotone insert",
+					time_start);
+			sum += map.size();
+		}
+		{
+			Map map;
+			unsigned long long time_start = get_time();
+			for (std::size_t i = 0; i < nb_elems; ++i) {
+				map.insert(typename Map::value_type(static_cast<long>(i), i));
+			}
+			print_duration("unhinted monotone insert", time_start);
+			sum += map.size();
+		}
+		std::cout << "- checksum : " << sum << std::endl;
+	}
+
+	void launch()
+	{
+		std::cout << "map hinted insert against std::map, " << nb_elems
+			<< " increasing long keys\n\n";
+		run< std::map<long, long> >("std::map");
+		std::cout << "\n";
+		run< ft::map<long, long> >("ft::map");
+		std::cout << std::flush;
+	}
+} }
@@ -0,0 +1,59 @@
+#include <iostream>
+#include <cstring>
+
+#include "benchmarks.hpp"
+
+int main(int argc, char* argv[])
+{
+	if (argc == 1) {
+		std::cout << "usage :" << std::endl
+			<< "  " << argv[0] << " benchmark_name" << std::endl;
+		return 1;
+	}
+	for (int i = 1; i < argc; ++i) {
+		std::cout << std::endl;
+		if (strcmp(argv[i], "rbt_node") == 0) {
+			benchmarks::rbt_node::launch();
+		}
+		else if (strcmp(argv[i], "btree") == 0) {
+			benchmarks::btree::launch();
+		}
+		else if (strcmp(argv[i], "hinted_insert") == 0) {
+			benchmarks::hinted_insert::launch();
+		}
+		else if (strcmp(argv[i], "sharded_map") == 0) {
+			benchmarks::sharded_map::launch();
+		}
+		else if (strcmp(argv[i], "unordered_map") == 0) {
+			benchmarks::unordered_map::launch();
+		}
+		else if (strcmp(argv[i], "rb_tree") == 0) {
+			benchmarks::rb_tree::launch();
+		}
+		else if (strcmp(argv[i], "range_scan") == 0) {
+			benchmarks::range_scan::launch();
+		}
+		else if (strcmp(argv[i], "compare") == 0) {
+			benchmarks::compare::launch();
+		}
+		else if (strcmp(argv[i], "concurrent_stack") == 0) {
+			benchmarks::concurrent_stack::launch();
+		}
+		else if (strcmp(argv[i], "stack") == 0) {
+			benchmarks::stack::launch();
+		}
+		else if (strcmp(argv[i], "reverse_range") == 0) {
+			benchmarks::reverse_range::launch();
+		}
+		else if (strcmp(argv[i], "string_growth") == 0) {
+			benchmarks::string_growth::launch();
+		}
+		else if (strcmp(argv[i], "emplace") == 0) {
+			benchmarks::emplace::launch();
+		}
+		else {
+			std::cout << "Unknown benchmark_name : " << argv[i] << std::endl;
+		}
+	}
+	return 0;
+}
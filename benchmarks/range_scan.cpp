@@ -0,0 +1,92 @@
+#include <map>
+
+#include "map.hpp"
+#include "benchmarks.hpp"
+
+namespace benchmarks { namespace range_scan
+{
+	int const nb_elems = 10000000;
+	int const nb_ranges = 1000;
+	int const range_length = 10000;
+
+	struct sum_mapped
+	{
+		long long sum;
+
+		sum_mapped() :
+			sum(0)
+		{
+			return;
+		}
+
+		void operator()(ft::pair<int const, int> const& val)
+		{
+			this->sum += val.second;
+		}
+	};
+
+	template <class Map>
+	long long iterator_scan(Map const& map, int lo, int hi)
+	{
+		long long sum = 0;
+		for (typename Map::const_iterator cit = map.lower_bound(lo),
+				cite = map.lower_bound(hi); cit != cite; ++cit) {
+			sum += cit->second;
+		}
+		return sum;
+	}
+
+	int range_start(int i)
+	{
+		return static_cast<int>((i * 7919LL) % (nb_elems - range_length));
+	}
+
+	void launch()
+	{
+		std::cout << "Range scans over " << nb_elems
+			<< " shuffled map nodes\n";
+		ft::map<int, int> map;
+		for (int i = 0; i < nb_elems; ++i) {
+			map.insert(ft::make_pair(static_cast<int>((i * 7919LL) % nb_elems),
+						i));
+		}
+
+		unsigned long long time_start = get_time();
+		long long sum = iterator_scan(map, 0, nb_elems);
+		print_duration("full scan, iterator loop", time_start);
+		std::cout << "  checksum : " << sum << std::endl;
+		time_start = get_time();
+		sum = map.for_each_in_range(0, nb_elems, sum_mapped()).sum;
+		print_duration("full scan, for_each_in_range", time_start);
+		std::cout << "  checksum : " << sum << std::endl;
+
+		time_start = get_time();
+		sum = 0;
+		for (int i = 0; i < nb_ranges; ++i) {
+			sum += iterator_scan(map, range_start(i),
+					range_start(i) + range_length);
+		}
+		print_duration("1000 scans of 10000 keys, iterator loop", time_start);
+		std::cout << "  checksum : " << sum << std::endl;
+		time_start = get_time();
+		sum = 0;
+		for (int i = 0; i < nb_ranges; ++i) {
+			sum += map.for_each_in_range(range_start(i),
+					range_start(i) + range_length, sum_mapped()).sum;
+		}
+		print_duration("1000 scans of 10000 keys, for_each_in_range",
+				time_start);
+		std::cout << "  checksum : " << sum << std::endl;
+		map.clear();
+
+		std::map<int, int> std_map;
+		for (int i = 0; i < nb_elems; ++i) {
+			std_map.insert(std::make_pair(
+						static_cast<int>((i * 7919LL) % nb_elems), i));
+		}
+		time_start = get_time();
+		sum = iterator_scan(std_map, 0, nb_elems);
+		print_duration("full scan, std::map iterator loop", time_start);
+		std::cout << "  checksum : " << sum << std::endl;
+	}
+} }
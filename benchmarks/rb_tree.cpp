@@ -0,0 +1,105 @@
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <cstdlib>
+#include <map>
+#include <set>
+
+#include "map.hpp"
+#include "set.hpp"
+#include "multimap.hpp"
+#include "benchmarks.hpp"
+
+namespace benchmarks { namespace rb_tree
+{
+	std::size_t const nb_elems = 1000000;
+
+	std::size_t shuffled_key(std::size_t i)
+	{
+		return (i * 7919) % nb_elems;
+	}
+
+	template <class Map>
+	void measure_map(char const* name)
+	{
+		std::cout << name << " :\n";
+		Map map;
+		unsigned long long time_start = get_time();
+		for (std::size_t i = 0; i < nb_elems; ++i) {
+			map.insert(typename Map::value_type(shuffled_key(i), i));
+		}
+		print_duration("insert", time_start);
+		time_start = get_time();
+		long long sum = 0;
+		for (std::size_t i = 0; i < nb_elems; ++i) {
+			sum += map.find(i)->second;
+		}
+		print_duration("find", time_start);
+		time_start = get_time();
+		for (typename Map::const_iterator cit = map.begin(), cite = map.end();
+				cit != cite; ++cit) {
+			sum += cit->first;
+		}
+		print_duration("iterate", time_start);
+		time_start = get_time();
+		for (std::size_t i = 0; i < nb_elems; i += 2) {
+			map.erase(shuffled_key(i));
+		}
+		print_duration("erase half", time_start);
+		std::cout << "- checksum : " << sum << ", size : " << map.size()
+			<< std::endl;
+	}
+
+	template <class Set>
+	void measure_set(char const* name)
+	{
+		std::cout << name << " :\n";
+		Set set;
+		unsigned long long time_start = get_time();
+		for (std::size_t i = 0; i < nb_elems; ++i) {
+			set.insert(shuffled_key(i));
+		}
+		print_duration("insert", time_start);
+		time_start = get_time();
+		std::size_t found = 0;
+		for (std::size_t i = 0; i < nb_elems * 2; i += 2) {
+			found += set.count(i);
+		}
+		print_duration("count, 50% misses", time_start);
+		time_start = get_time();
+		Set copy(set);
+		print_duration("copy", time_start);
+		std::cout << "- found : " << found << ", size : " << copy.size()
+			<< std::endl;
+	}
+
+	// Each container is measured in its own process, the heap fragmented by
+	// a previous measurement slows the next one down a lot.
+	void measure_in_child(void (*measure)(char const*), char const* name)
+	{
+		std::cout << std::flush;
+		pid_t pid = fork();
+		if (pid == 0) {
+			measure(name);
+			std::exit(0);
+		}
+		if (pid > 0) {
+			waitpid(pid, NULL, 0);
+		}
+		return;
+	}
+
+	void launch()
+	{
+		std::cout << "Red-black tree containers, " << nb_elems << " elems\n";
+		measure_in_child(measure_map< ft::map<int, int> >, "ft::map");
+		measure_in_child(measure_map< std::map<int, int> >, "std::map");
+		measure_in_child(measure_map< ft::multimap<int, int> >, "ft::multimap");
+		measure_in_child(measure_map< std::multimap<int, int> >,
+				"std::multimap");
+		std::cout << "\n";
+		measure_in_child(measure_set< ft::set<int> >, "ft::set");
+		measure_in_child(measure_set< std::set<int> >, "std::set");
+		std::cout << std::flush;
+	}
+} }
@@ -0,0 +1,63 @@
+#include <map>
+
+#include "map.hpp"
+#include "benchmarks.hpp"
+
+namespace benchmarks { namespace rbt_node
+{
+	// Layout of ft::rbt_node before the color was packed in the parent pointer
+	template <class ValueType>
+	struct unpacked_rbt_node
+	{
+		ValueType val;
+		bool is_red;
+		unpacked_rbt_node* parent;
+		unpacked_rbt_node* left;
+		unpacked_rbt_node* right;
+	};
+
+	std::size_t const nb_elems = 1000000;
+
+	template <class Map>
+	void fill_and_measure(char const* name)
+	{
+		std::size_t bytes_start = allocation_stats::bytes;
+		unsigned long long time_start = get_time();
+		{
+			Map map;
+			for (std::size_t i = 0; i < nb_elems; ++i) {
+				map.insert(typename Map::value_type((i * 7919) % nb_elems, i));
+			}
+			std::size_t bytes = allocation_stats::bytes - bytes_start;
+			std::cout << name << " :\n- memory : " << bytes << " bytes, "
+				<< static_cast<double>(bytes) / map.size() << " bytes per elem"
+				<< std::endl;
+			long long sum = 0;
+			for (std::size_t i = 0; i < nb_elems; ++i) {
+				sum += map.find(i)->second;
+			}
+			std::cout << "- checksum : " << sum << std::endl;
+		}
+		print_duration("insert + find + destroy", time_start);
+	}
+
+	void launch()
+	{
+		typedef ft::pair<int const, int> value_type;
+
+		std::cout << "rbt_node memory footprint, " << nb_elems
+			<< " pair<int, int> elems\n";
+		std::cout << "- sizeof unpacked node : "
+			<< sizeof(unpacked_rbt_node<value_type>) << " bytes\n";
+		std::cout << "- sizeof packed node : "
+			<< sizeof(ft::rbt_node<value_type>) << " bytes\n";
+		std::cout << "- unpacked layout estimate : "
+			<< sizeof(unpacked_rbt_node<value_type>) * nb_elems << " bytes\n\n";
+		fill_and_measure< ft::map<int, int, ft::less<int>,
+			counting_allocator<value_type> > >("ft::map");
+		std::cout << "\n";
+		fill_and_measure< std::map<int, int, std::less<int>,
+			counting_allocator< std::pair<int const, int> > > >("std::map");
+		std::cout << std::flush;
+	}
+} }
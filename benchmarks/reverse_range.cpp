@@ -0,0 +1,68 @@
+#include "vector.hpp"
+#include "list.hpp"
+#include "benchmarks.hpp"
+
+namespace benchmarks { namespace reverse_range
+{
+	int const nb_elems = 10000000;
+	int const nb_rounds = 10;
+	int const nb_list_elems = 1000000;
+
+	void launch()
+	{
+		ft::vector<int> source;
+		source.reserve(nb_elems);
+		for (int i = 0; i < nb_elems; ++i) {
+			source.push_back(i);
+		}
+		ft::vector<int> copy(source);
+
+		std::cout << "ft::vector<int> of " << nb_elems
+			<< " elements built from a reversed range, " << nb_rounds
+			<< " rounds\n";
+		long long checksum = 0;
+		unsigned long long time_start = get_time();
+		for (int i = 0; i < nb_rounds; ++i) {
+			ft::vector<int> vec(source.rbegin(), source.rend());
+			checksum += vec.front();
+		}
+		print_duration("range constructor", time_start);
+		time_start = get_time();
+		for (int i = 0; i < nb_rounds; ++i) {
+			ft::vector<int> vec(source.begin(), source.end());
+			checksum += vec.front();
+		}
+		print_duration("range constructor, forward range", time_start);
+		ft::vector<int> reused(nb_elems);
+		time_start = get_time();
+		for (int i = 0; i < nb_rounds; ++i) {
+			reused.assign(source.rbegin(), source.rend());
+			checksum += reused.front();
+		}
+		print_duration("assign to a vector with capacity", time_start);
+		time_start = get_time();
+		for (int i = 0; i < nb_rounds; ++i) {
+			reused.clear();
+			reused.insert(reused.end(), source.rbegin(), source.rend());
+			checksum += reused.front();
+		}
+		print_duration("insert to a vector with capacity", time_start);
+		time_start = get_time();
+		for (int i = 0; i < nb_rounds; ++i) {
+			checksum += ft::equal(source.rbegin(), source.rend(), copy.rbegin());
+		}
+		print_duration("equal of two reversed ranges", time_start);
+		std::cout << "  checksum : " << checksum << std::endl;
+
+		std::cout << "ft::list<int> of " << nb_list_elems
+			<< " elements built from a reversed range, " << nb_rounds
+			<< " rounds\n";
+		time_start = get_time();
+		for (int i = 0; i < nb_rounds; ++i) {
+			ft::list<int> lst(source.rbegin(), source.rbegin() + nb_list_elems);
+			checksum += lst.front();
+		}
+		print_duration("range constructor", time_start);
+		std::cout << "  checksum : " << checksum << std::endl;
+	}
+} }
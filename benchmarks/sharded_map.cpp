@@ -0,0 +1,159 @@
+#include <pthread.h>
+
+#include "map.hpp"
+#include "sharded_map.hpp"
+#include "benchmarks.hpp"
+
+namespace benchmarks { namespace sharded_map
+{
+	long const nb_keys = 100000;
+	long const nb_ops = 4000000;
+	std::size_t const shard_count = 64;
+
+	// ft::map behind a single reader-writer lock, the baseline that
+	// sharding is measured against
+	class locked_map
+	{
+	public:
+		locked_map()
+		{
+			pthread_rwlock_init(&this->lock_, NULL);
+			return;
+		}
+
+		~locked_map()
+		{
+			pthread_rwlock_destroy(&this->lock_);
+			return;
+		}
+
+		bool find(long k, long& value) const
+		{
+			pthread_rwlock_rdlock(&this->lock_);
+			ft::map<long, long>::const_iterator it = this->map_.find(k);
+			bool found = it != this->map_.end();
+			if (found == true) {
+				value = it->second;
+			}
+			pthread_rwlock_unlock(&this->lock_);
+			return found;
+		}
+
+		bool insert(ft::pair<long const, long> const& val)
+		{
+			pthread_rwlock_wrlock(&this->lock_);
+			bool inserted = this->map_.insert(val).second;
+			pthread_rwlock_unlock(&this->lock_);
+			return inserted;
+		}
+
+		std::size_t erase(long k)
+		{
+			pthread_rwlock_wrlock(&this->lock_);
+			std::size_t erased = this->map_.erase(k);
+			pthread_rwlock_unlock(&this->lock_);
+			return erased;
+		}
+
+	private:
+		mutable pthread_rwlock_t lock_;
+		ft::map<long, long> map_;
+	};
+
+	template <class Map>
+	struct worker_arg
+	{
+		Map* map;
+		unsigned long seed;
+		long ops;
+		long checksum;
+	};
+
+	// 80% find, 10% insert, 10% erase over uniformly random keys
+	template <class Map>
+	void* worker(void* arg)
+	{
+		worker_arg<Map>* warg = static_cast<worker_arg<Map>*>(arg);
+		unsigned long state = warg->seed;
+		long checksum = 0;
+		for (long i = 0; i < warg->ops; ++i) {
+			state = state * 6364136223846793005UL + 1442695040888963407UL;
+			long k = static_cast<long>((state >> 33) % nb_keys);
+			unsigned long op = (state >> 20) % 10;
+			if (op == 0) {
+				checksum += warg->map->insert(ft::make_pair(k, k));
+			}
+			else if (op == 1) {
+				checksum += warg->map->erase(k);
+			}
+			else {
+				long value = 0;
+				checksum += warg->map->find(k, value);
+			}
+		}
+		warg->checksum = checksum;
+		return NULL;
+	}
+
+	template <class Map>
+	void run(char const* name, Map& map, int nb_threads)
+	{
+		pthread_t threads[32];
+		worker_arg<Map> args[32];
+		unsigned long long time_start = get_time();
+		int started = 0;
+		for (int i = 0; i < nb_threads; ++i) {
+			args[i].map = &map;
+			args[i].seed = i + 1;
+			args[i].ops = nb_ops / nb_threads;
+			args[i].checksum = 0;
+			if (pthread_create(&threads[i], NULL, &worker<Map>, &args[i]) != 0) {
+				break;
+			}
+			started++;
+		}
+		for (int i = started; i < nb_threads; ++i) {
+			worker<Map>(&args[i]);
+		}
+		long checksum = 0;
+		for (int i = 0; i < nb_threads; ++i) {
+			if (i < started) {
+				pthread_join(threads[i], NULL);
+			}
+			checksum += args[i].checksum;
+		}
+		unsigned long long duration = get_time() - time_start;
+		if (duration == 0) {
+			duration = 1;
+		}
+		std::cout << "- " << name << ", " << nb_threads << " threads : "
+			<< nb_ops * 1000ULL / duration << " ops/ms, checksum "
+			<< checksum << std::endl;
+	}
+
+	void launch()
+	{
+		std::cout << "sharded_map (" << shard_count << " shards) against a "
+			"single lock ft::map, " << nb_ops << " ops over " << nb_keys
+			<< " long keys, 80% find 10% insert 10% erase\n\n";
+		int const thread_counts[] = { 1, 2, 4, 8, 16, 32 };
+		for (std::size_t i = 0; i < sizeof(thread_counts)
+				/ sizeof(*thread_counts); ++i) {
+			{
+				locked_map map;
+				for (long k = 0; k < nb_keys; k += 2) {
+					map.insert(ft::make_pair(k, k));
+				}
+				run("single lock ft::map", map, thread_counts[i]);
+			}
+			{
+				ft::sharded_map<long, long> map(shard_count);
+				for (long k = 0; k < nb_keys; k += 2) {
+					map.insert(ft::make_pair(k, k));
+				}
+				run("ft::sharded_map", map, thread_counts[i]);
+			}
+		}
+		std::cout << std::flush;
+	}
+} }
@@ -0,0 +1,71 @@
+#include "stack.hpp"
+#include "benchmarks.hpp"
+
+namespace benchmarks { namespace stack
+{
+	int const nb_bursts = 200000;
+	int const burst_size = 256;
+
+	void launch()
+	{
+		std::cout << "ft::stack<int>, " << nb_bursts << " bursts of "
+			<< burst_size << " pushes then pops\n";
+		int tokens[burst_size];
+		for (int i = 0; i < burst_size; ++i) {
+			tokens[i] = i;
+		}
+
+		long long checksum = 0;
+		unsigned long long time_start = get_time();
+		for (int i = 0; i < nb_bursts; ++i) {
+			ft::stack<int> stack;
+			for (int j = 0; j < burst_size; ++j) {
+				stack.push(tokens[j]);
+			}
+			checksum += stack.top();
+			for (int j = 0; j < burst_size; ++j) {
+				stack.pop();
+			}
+		}
+		print_duration("push and pop loops, new stack per burst", time_start);
+		std::cout << "  checksum : " << checksum << std::endl;
+
+		checksum = 0;
+		time_start = get_time();
+		for (int i = 0; i < nb_bursts; ++i) {
+			ft::stack<int> stack;
+			stack.push_range(tokens, tokens + burst_size);
+			checksum += stack.top();
+			stack.pop_n(burst_size);
+		}
+		print_duration("push_range and pop_n, new stack per burst", time_start);
+		std::cout << "  checksum : " << checksum << std::endl;
+
+		checksum = 0;
+		ft::stack<int> stack;
+		time_start = get_time();
+		for (int i = 0; i < nb_bursts; ++i) {
+			for (int j = 0; j < burst_size; ++j) {
+				stack.push(tokens[j]);
+			}
+			checksum += stack.top();
+			for (int j = 0; j < burst_size; ++j) {
+				stack.pop();
+			}
+		}
+		print_duration("push and pop loops, reused stack", time_start);
+		std::cout << "  checksum : " << checksum << std::endl;
+
+		checksum = 0;
+		ft::stack<int> reserved;
+		reserved.reserve(burst_size);
+		time_start = get_time();
+		for (int i = 0; i < nb_bursts; ++i) {
+			reserved.push_range(tokens, tokens + burst_size);
+			checksum += reserved.top();
+			reserved.pop_n(burst_size);
+		}
+		print_duration("push_range and pop_n, reserved stack", time_start);
+		std::cout << "  checksum : " << checksum << std::endl;
+	}
+} }
@@ -0,0 +1,41 @@
+#include <string>
+
+#include "vector.hpp"
+#include "benchmarks.hpp"
+
+namespace benchmarks { namespace string_growth
+{
+	int const nb_elems = 1000000;
+	int const nb_rounds = 5;
+
+	// Growth without reserve relocates every string at each reallocation,
+	// by copy in C++98 and by move in C++11.
+	void launch()
+	{
+		std::string const word(40, 'x');
+
+		std::cout << "ft::vector<std::string> of " << nb_elems
+			<< " strings of " << word.size() << " chars grown without reserve, "
+			<< nb_rounds << " rounds, __cplusplus " << __cplusplus << "\n";
+		long long checksum = 0;
+		unsigned long long time_start = get_time();
+		for (int i = 0; i < nb_rounds; ++i) {
+			ft::vector<std::string> vec;
+			for (int j = 0; j < nb_elems; ++j) {
+				vec.push_back(word);
+			}
+			checksum += vec.back().size();
+		}
+		print_duration("push_back of a named string", time_start);
+		time_start = get_time();
+		for (int i = 0; i < nb_rounds; ++i) {
+			ft::vector<std::string> vec;
+			for (int j = 0; j < nb_elems; ++j) {
+				vec.push_back(std::string(word.size(), 'y'));
+			}
+			checksum += vec.back().size();
+		}
+		print_duration("push_back of a temporary string", time_start);
+		std::cout << "  checksum : " << checksum << std::endl;
+	}
+} }
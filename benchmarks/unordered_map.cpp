@@ -0,0 +1,70 @@
+#include <map>
+#include <vector>
+
+#include "map.hpp"
+#include "unordered_map.hpp"
+#include "benchmarks.hpp"
+
+namespace benchmarks { namespace unordered_map
+{
+	std::size_t const nb_elems = 1000000;
+	std::size_t const nb_lookups = 4000000;
+
+	void make_keys(std::vector<long>& keys, unsigned long state)
+	{
+		keys.resize(nb_elems);
+		for (std::size_t i = 0; i < nb_elems; ++i) {
+			state = state * 6364136223846793005UL + 1442695040888963407UL;
+			keys[i] = static_cast<long>(state >> 17);
+		}
+		return;
+	}
+
+	template <class Map>
+	void run(char const* name, std::vector<long> const& keys,
+			std::vector<long> const& missing_keys)
+	{
+		std::cout << name << " :\n";
+		long long sum = 0;
+		Map map;
+		unsigned long long time_start = get_time();
+		for (std::size_t i = 0; i < nb_elems; ++i) {
+			map.insert(typename Map::value_type(keys[i], i));
+		}
+		print_duration("insert", time_start);
+		time_start = get_time();
+		for (std::size_t i = 0; i < nb_elems; ++i) {
+			sum += map.find(keys[i])->second;
+		}
+		print_duration("find", time_start);
+		time_start = get_time();
+		for (std::size_t i = 0; i < nb_lookups; ++i) {
+			std::size_t j = (i >> 1) % nb_elems;
+			sum += map.count((i & 1) == 0 ? keys[j] : missing_keys[j]);
+		}
+		print_duration("count, 50% misses", time_start);
+		time_start = get_time();
+		for (std::size_t i = 0; i < nb_elems; ++i) {
+			sum += map.erase(keys[i]);
+		}
+		print_duration("erase", time_start);
+		std::cout << "- checksum : " << sum << std::endl;
+	}
+
+	void launch()
+	{
+		std::cout << "unordered_map against ft::map and std::map, " << nb_elems
+			<< " random long keys, " << nb_lookups << " lookups\n\n";
+		std::vector<long> keys;
+		std::vector<long> missing_keys;
+		make_keys(keys, 42);
+		make_keys(missing_keys, 4242);
+		run< std::map<long, long> >("std::map", keys, missing_keys);
+		std::cout << "\n";
+		run< ft::map<long, long> >("ft::map", keys, missing_keys);
+		std::cout << "\n";
+		run< ft::unordered_map<long, long> >("ft::unordered_map", keys,
+				missing_keys);
+		std::cout << std::flush;
+	}
+} }
@@ -0,0 +1,920 @@
+#ifndef BTREE_HPP
+#define BTREE_HPP
+
+#include <iterator>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+#include "reverse_iterator.hpp"
+#include "iterator_traits.hpp"
+
+#include "pair.hpp"
+#include "btree_node.hpp"
+
+namespace ft
+{
+	// Ordered unique-key storage shared by btree_map and btree_set.
+	// Unlike the red-black tree containers, insert and erase invalidate
+	// every iterator since values move between nodes.
+	template <class Key, class Value, class KeyOfValue, class Compare,
+			 class Alloc>
+	class btree
+	{
+	public:
+		typedef Key key_type;
+		typedef Value value_type;
+		typedef Compare key_compare;
+		typedef Alloc allocator_type;
+		typedef typename allocator_type::reference reference;
+		typedef typename allocator_type::const_reference const_reference;
+		typedef typename allocator_type::pointer pointer;
+		typedef typename allocator_type::const_pointer const_pointer;
+		class iterator;
+		class const_iterator;
+		typedef ft::reverse_iterator<iterator> reverse_iterator;
+		typedef ft::reverse_iterator<const_iterator> const_reverse_iterator;
+		typedef std::ptrdiff_t difference_type;
+		typedef std::size_t size_type;
+
+	protected:
+		typedef btree_node<value_type> node_type;
+		typedef btree_internal_node<value_type> internal_node_type;
+		typedef typename allocator_type::template rebind<node_type>::other
+			leaf_allocator_type;
+		typedef typename allocator_type::template rebind<internal_node_type>::other
+			internal_allocator_type;
+
+		enum { max_values = node_type::max_values };
+		enum { min_values = node_type::min_values };
+
+	public:
+		class iterator
+		{
+		public:
+			typedef typename ft::iterator_traits<typename btree::pointer>::value_type value_type;
+			typedef typename ft::iterator_traits<typename btree::pointer>::difference_type difference_type;
+			typedef typename btree::pointer pointer;
+			typedef typename ft::iterator_traits<pointer>::reference reference;
+			typedef std::bidirectional_iterator_tag iterator_category;
+
+			node_type* node_;
+			int position_;
+
+			iterator() :
+				node_(NULL),
+				position_(0)
+			{
+				return;
+			}
+
+			iterator(node_type* node, int position) :
+				node_(node),
+				position_(position)
+			{
+				return;
+			}
+
+			iterator(iterator const& src) :
+				node_(src.node_),
+				position_(src.position_)
+			{
+				return;
+			}
+
+			~iterator()
+			{
+				return;
+			}
+
+			iterator& operator=(iterator const& rhs)
+			{
+				this->node_ = rhs.node_;
+				this->position_ = rhs.position_;
+				return *this;
+			}
+
+			bool operator==(const_iterator const& rhs) const
+			{
+				return this->node_ == rhs.node_
+					&& this->position_ == rhs.position_;
+			}
+
+			bool operator!=(const_iterator const& rhs) const
+			{
+				return !(*this == rhs);
+			}
+
+			reference operator*() const
+			{
+				return this->node_->value(this->position_);
+			}
+
+			pointer operator->() const
+			{
+				return &this->node_->value(this->position_);
+			}
+
+			iterator& operator++()
+			{
+				node_type::increment(this->node_, this->position_);
+				return *this;
+			}
+
+			iterator operator++(int)
+			{
+				iterator tmp = *this;
+				++(*this);
+				return tmp;
+			}
+
+			iterator& operator--()
+			{
+				node_type::decrement(this->node_, this->position_);
+				return *this;
+			}
+
+			iterator operator--(int)
+			{
+				iterator tmp = *this;
+				--(*this);
+				return tmp;
+			}
+		};
+
+		class const_iterator
+		{
+		public:
+			typedef typename ft::iterator_traits<const_pointer>::value_type value_type;
+			typedef typename ft::iterator_traits<const_pointer>::difference_type difference_type;
+			typedef const_pointer pointer;
+			typedef typename ft::iterator_traits<const_pointer>::reference reference;
+			typedef std::bidirectional_iterator_tag iterator_category;
+
+			node_type* node_;
+			int position_;
+
+			const_iterator() :
+				node_(NULL),
+				position_(0)
+			{
+				return;
+			}
+
+			const_iterator(node_type* node, int position) :
+				node_(node),
+				position_(position)
+			{
+				return;
+			}
+
+			const_iterator(iterator const& src) :
+				node_(src.node_),
+				position_(src.position_)
+			{
+				return;
+			}
+
+			const_iterator(const_iterator const& src) :
+				node_(src.node_),
+				position_(src.position_)
+			{
+				return;
+			}
+
+			~const_iterator()
+			{
+				return;
+			}
+
+			const_iterator& operator=(const_iterator const& rhs)
+			{
+				this->node_ = rhs.node_;
+				this->position_ = rhs.position_;
+				return *this;
+			}
+
+			bool operator==(const_iterator const& rhs) const
+			{
+				return this->node_ == rhs.node_
+					&& this->position_ == rhs.position_;
+			}
+
+			bool operator!=(const_iterator const& rhs) const
+			{
+				return !(*this == rhs);
+			}
+
+			reference operator*() const
+			{
+				return this->node_->value(this->position_);
+			}
+
+			pointer operator->() const
+			{
+				return &this->node_->value(this->position_);
+			}
+
+			const_iterator& operator++()
+			{
+				node_type::increment(this->node_, this->position_);
+				return *this;
+			}
+
+			const_iterator operator++(int)
+			{
+				const_iterator tmp = *this;
+				++(*this);
+				return tmp;
+			}
+
+			const_iterator& operator--()
+			{
+				node_type::decrement(this->node_, this->position_);
+				return *this;
+			}
+
+			const_iterator operator--(int)
+			{
+				const_iterator tmp = *this;
+				--(*this);
+				return tmp;
+			}
+		};
+
+	protected:
+		key_compare comp_;
+		allocator_type alloc_;
+		leaf_allocator_type leaf_alloc_;
+		internal_allocator_type internal_alloc_;
+		node_type* root_node_;
+		node_type* leftmost_node_;
+		node_type* rightmost_node_;
+		size_type size_;
+
+	public:
+		explicit btree(key_compare const& comp = key_compare(),
+				allocator_type const& alloc = allocator_type()) :
+			comp_(comp),
+			alloc_(alloc),
+			leaf_alloc_(),
+			internal_alloc_(),
+			root_node_(NULL),
+			leftmost_node_(NULL),
+			rightmost_node_(NULL),
+			size_(0)
+		{
+			return;
+		}
+
+		btree(btree const& x) :
+			comp_(x.comp_),
+			alloc_(x.alloc_),
+			leaf_alloc_(x.leaf_alloc_),
+			internal_alloc_(x.internal_alloc_),
+			root_node_(NULL),
+			leftmost_node_(NULL),
+			rightmost_node_(NULL),
+			size_(0)
+		{
+			*this = x;
+			return;
+		}
+
+		~btree()
+		{
+			this->clear();
+			return;
+		}
+
+		btree& operator=(btree const& x)
+		{
+			if (&x == this) {
+				return *this;
+			}
+			this->clear();
+			this->comp_ = x.comp_;
+			if (x.root_node_) {
+				this->root_node_ = this->clone_node(x.root_node_, NULL);
+				this->leftmost_node_ = this->root_node_->get_leftmost_leaf();
+				this->rightmost_node_ = this->root_node_->get_rightmost_leaf();
+				this->size_ = x.size_;
+			}
+			return *this;
+		}
+
+#if __cplusplus >= 201103L
+		btree(btree&& x) :
+			btree(x.comp_, x.alloc_)
+		{
+			this->swap(x);
+			return;
+		}
+
+		btree& operator=(btree&& x)
+		{
+			if (this != &x) {
+				this->clear();
+				this->swap(x);
+			}
+			return *this;
+		}
+#endif
+
+		iterator begin()
+		{
+			return iterator(this->leftmost_node_, 0);
+		}
+
+		const_iterator begin() const
+		{
+			return const_iterator(this->leftmost_node_, 0);
+		}
+
+		iterator end()
+		{
+			return this->end_impl();
+		}
+
+		const_iterator end() const
+		{
+			return this->end_impl();
+		}
+
+		reverse_iterator rbegin()
+		{
+			return reverse_iterator(this->end());
+		}
+
+		const_reverse_iterator rbegin() const
+		{
+			return const_reverse_iterator(this->end());
+		}
+
+		reverse_iterator rend()
+		{
+			return reverse_iterator(this->begin());
+		}
+
+		const_reverse_iterator rend() const
+		{
+			return const_reverse_iterator(this->begin());
+		}
+
+		bool empty() const
+		{
+			return this->size_ == 0;
+		}
+
+		size_type size() const
+		{
+			return this->size_;
+		}
+
+		size_type max_size() const
+		{
+			return this->alloc_.max_size();
+		}
+
+		ft::pair<iterator,bool> insert_unique(value_type const& val)
+		{
+			if (this->root_node_ == NULL) {
+				this->root_node_ = this->create_node(true);
+				this->leftmost_node_ = this->root_node_;
+				this->rightmost_node_ = this->root_node_;
+			}
+			key_type const& key = KeyOfValue()(val);
+			node_type* node = this->root_node_;
+			while (1) {
+				int position = this->lower_bound_in_node(node, key);
+				if (position < node->count && this->comp_(key,
+							KeyOfValue()(node->value(position))) == false) {
+					return ft::pair<iterator,bool>(iterator(node, position),
+							false);
+				}
+				if (node->is_leaf) {
+					return ft::pair<iterator,bool>(
+							this->insert_in_leaf(node, position, val), true);
+				}
+				node = node->child(position);
+			}
+		}
+
+		void erase(iterator position)
+		{
+			node_type* node = position.node_;
+			int i = position.position_;
+			if (node->is_leaf == false) {
+				node_type* leaf = node->child(i)->get_rightmost_leaf();
+				this->alloc_.destroy(&node->value(i));
+				this->move_value(node, i, leaf, leaf->count - 1);
+				node = leaf;
+			}
+			else {
+				this->alloc_.destroy(&node->value(i));
+				for (int last = node->count - 1; i < last; ++i) {
+					this->move_value(node, i, node, i + 1);
+				}
+			}
+			node->count--;
+			this->size_--;
+			this->rebalance_after_erase(node);
+			return;
+		}
+
+		size_type erase_unique(key_type const& k)
+		{
+			iterator it = this->find_impl(k);
+			if (it == this->end_impl()) {
+				return 0;
+			}
+			this->erase(it);
+			return 1;
+		}
+
+		void erase(iterator first, iterator last)
+		{
+			if (first == this->begin() && last == this->end()) {
+				this->clear();
+				return;
+			}
+			size_type n = 0;
+			for (iterator it = first; it != last; ++it) {
+				n++;
+			}
+			while (n > 1) {
+				iterator next = first;
+				++next;
+				key_type next_key = KeyOfValue()(*next);
+				this->erase(first);
+				first = this->lower_bound_impl(next_key);
+				n--;
+			}
+			if (n == 1) {
+				this->erase(first);
+			}
+			return;
+		}
+
+		void swap(btree& x)
+		{
+			key_compare key_compare_tmp = this->comp_;
+			this->comp_ = x.comp_;
+			x.comp_ = key_compare_tmp;
+			allocator_type allocator_tmp = this->alloc_;
+			this->alloc_ = x.alloc_;
+			x.alloc_ = allocator_tmp;
+			node_type* node_tmp = this->root_node_;
+			this->root_node_ = x.root_node_;
+			x.root_node_ = node_tmp;
+			node_tmp = this->leftmost_node_;
+			this->leftmost_node_ = x.leftmost_node_;
+			x.leftmost_node_ = node_tmp;
+			node_tmp = this->rightmost_node_;
+			this->rightmost_node_ = x.rightmost_node_;
+			x.rightmost_node_ = node_tmp;
+			size_type size_tmp = this->size_;
+			this->size_ = x.size_;
+			x.size_ = size_tmp;
+			return;
+		}
+
+		void clear()
+		{
+			if (this->root_node_) {
+				this->clear_node(this->root_node_);
+			}
+			this->root_node_ = NULL;
+			this->leftmost_node_ = NULL;
+			this->rightmost_node_ = NULL;
+			this->size_ = 0;
+			return;
+		}
+
+		key_compare key_comp() const
+		{
+			return this->comp_;
+		}
+
+		iterator find(key_type const& k)
+		{
+			return this->find_impl(k);
+		}
+
+		const_iterator find(key_type const& k) const
+		{
+			return this->find_impl(k);
+		}
+
+		size_type count(key_type const& k) const
+		{
+			if (this->find_impl(k) != this->end_impl()) {
+				return 1;
+			}
+			return 0;
+		}
+
+		iterator lower_bound(key_type const& k)
+		{
+			return this->lower_bound_impl(k);
+		}
+
+		const_iterator lower_bound(key_type const& k) const
+		{
+			return this->lower_bound_impl(k);
+		}
+
+		iterator upper_bound(key_type const& k)
+		{
+			return this->upper_bound_impl(k);
+		}
+
+		const_iterator upper_bound(key_type const& k) const
+		{
+			return this->upper_bound_impl(k);
+		}
+
+		ft::pair<iterator,iterator> equal_range(key_type const& k)
+		{
+			return this->equal_range_impl(k);
+		}
+
+		ft::pair<const_iterator,const_iterator> equal_range(
+				key_type const& k) const
+		{
+			ft::pair<iterator,iterator> range = this->equal_range_impl(k);
+			return ft::pair<const_iterator,const_iterator>(range.first,
+					range.second);
+		}
+
+		allocator_type get_allocator() const
+		{
+			return this->alloc_;
+		}
+
+	private:
+		iterator end_impl() const
+		{
+			if (this->rightmost_node_ == NULL) {
+				return iterator(NULL, 0);
+			}
+			return iterator(this->rightmost_node_, this->rightmost_node_->count);
+		}
+
+		int lower_bound_in_node(node_type const* node, key_type const& k) const
+		{
+			int first = 0;
+			int last = node->count;
+			while (first < last) {
+				int middle = (first + last) / 2;
+				if (this->comp_(KeyOfValue()(node->value(middle)), k) == true) {
+					first = middle + 1;
+				}
+				else {
+					last = middle;
+				}
+			}
+			return first;
+		}
+
+		int upper_bound_in_node(node_type const* node, key_type const& k) const
+		{
+			int first = 0;
+			int last = node->count;
+			while (first < last) {
+				int middle = (first + last) / 2;
+				if (this->comp_(k, KeyOfValue()(node->value(middle))) == false) {
+					first = middle + 1;
+				}
+				else {
+					last = middle;
+				}
+			}
+			return first;
+		}
+
+		iterator find_impl(key_type const& k) const
+		{
+			node_type* node = this->root_node_;
+			while (node) {
+				int position = this->lower_bound_in_node(node, k);
+				if (position < node->count && this->comp_(k,
+							KeyOfValue()(node->value(position))) == false) {
+					return iterator(node, position);
+				}
+				if (node->is_leaf) {
+					break;
+				}
+				node = node->child(position);
+			}
+			return this->end_impl();
+		}
+
+		iterator lower_bound_impl(key_type const& k) const
+		{
+			iterator result = this->end_impl();
+			node_type* node = this->root_node_;
+			while (node) {
+				int position = this->lower_bound_in_node(node, k);
+				if (position < node->count) {
+					result = iterator(node, position);
+					if (this->comp_(k,
+								KeyOfValue()(node->value(position))) == false) {
+						break;
+					}
+				}
+				if (node->is_leaf) {
+					break;
+				}
+				node = node->child(position);
+			}
+			return result;
+		}
+
+		iterator upper_bound_impl(key_type const& k) const
+		{
+			iterator result = this->end_impl();
+			node_type* node = this->root_node_;
+			while (node) {
+				int position = this->upper_bound_in_node(node, k);
+				if (position < node->count) {
+					result = iterator(node, position);
+				}
+				if (node->is_leaf) {
+					break;
+				}
+				node = node->child(position);
+			}
+			return result;
+		}
+
+		ft::pair<iterator,iterator> equal_range_impl(key_type const& k) const
+		{
+			iterator it = this->lower_bound_impl(k);
+			if (it != this->end_impl()
+					&& this->comp_(k, KeyOfValue()(*it)) == false) {
+				iterator next = it;
+				++next;
+				return ft::pair<iterator,iterator>(it, next);
+			}
+			return ft::pair<iterator,iterator>(it, it);
+		}
+
+		node_type* create_node(bool is_leaf)
+		{
+			node_type* node;
+			if (is_leaf) {
+				node = this->leaf_alloc_.allocate(1);
+			}
+			else {
+				node = this->internal_alloc_.allocate(1);
+			}
+			node->parent = NULL;
+			node->position = 0;
+			node->count = 0;
+			node->is_leaf = is_leaf;
+			return node;
+		}
+
+		void delete_node(node_type* node)
+		{
+			if (node->is_leaf) {
+				this->leaf_alloc_.deallocate(node, 1);
+			}
+			else {
+				this->internal_alloc_.deallocate(
+						static_cast<internal_node_type*>(node), 1);
+			}
+			return;
+		}
+
+		void move_value(node_type* dest, int dest_i, node_type* src, int src_i)
+		{
+			this->alloc_.construct(&dest->value(dest_i), src->value(src_i));
+			this->alloc_.destroy(&src->value(src_i));
+			return;
+		}
+
+		void set_child(node_type* parent, int i, node_type* child)
+		{
+			parent->child(i) = child;
+			child->parent = parent;
+			child->position = i;
+			return;
+		}
+
+		iterator insert_in_leaf(node_type* node, int position,
+				value_type const& val)
+		{
+			if (node->count == max_values) {
+				int split_position = max_values / 2;
+				// keep sequential insertions packed in full nodes
+				if (node == this->rightmost_node_ && position == max_values) {
+					split_position = max_values - 1;
+				}
+				else if (node == this->leftmost_node_ && position == 0) {
+					split_position = 1;
+				}
+				this->split_node(node, split_position);
+				if (position > node->count) {
+					position -= node->count + 1;
+					node = node->parent->child(node->position + 1);
+				}
+			}
+			for (int i = node->count; i > position; --i) {
+				this->move_value(node, i, node, i - 1);
+			}
+			this->alloc_.construct(&node->value(position), val);
+			node->count++;
+			this->size_++;
+			return iterator(node, position);
+		}
+
+		void split_node(node_type* node, int split_position)
+		{
+			node_type* parent = node->parent;
+			if (parent == NULL) {
+				parent = this->create_node(false);
+				this->set_child(parent, 0, node);
+				this->root_node_ = parent;
+			}
+			else if (parent->count == max_values) {
+				this->split_node(parent, max_values / 2);
+				parent = node->parent;
+			}
+			node_type* sibling = this->create_node(node->is_leaf);
+			int moved = node->count - split_position - 1;
+			for (int i = 0; i < moved; ++i) {
+				this->move_value(sibling, i, node, split_position + 1 + i);
+			}
+			if (node->is_leaf == false) {
+				for (int i = 0; i <= moved; ++i) {
+					this->set_child(sibling, i,
+							node->child(split_position + 1 + i));
+				}
+			}
+			sibling->count = moved;
+			int position = node->position;
+			for (int i = parent->count; i > position; --i) {
+				this->move_value(parent, i, parent, i - 1);
+				this->set_child(parent, i + 1, parent->child(i));
+			}
+			this->move_value(parent, position, node, split_position);
+			this->set_child(parent, position + 1, sibling);
+			parent->count++;
+			node->count = split_position;
+			if (node == this->rightmost_node_) {
+				this->rightmost_node_ = sibling;
+			}
+			return;
+		}
+
+		void rebalance_after_erase(node_type* node)
+		{
+			while (node != this->root_node_ && node->count < min_values) {
+				node_type* parent = node->parent;
+				int position = node->position;
+				node_type* left = NULL;
+				node_type* right = NULL;
+				if (position > 0) {
+					left = parent->child(position - 1);
+				}
+				if (position < parent->count) {
+					right = parent->child(position + 1);
+				}
+				if (left && left->count + node->count + 1 <= max_values) {
+					this->merge_nodes(left, node);
+				}
+				else if (right
+						&& node->count + right->count + 1 <= max_values) {
+					this->merge_nodes(node, right);
+				}
+				else if (left && (right == NULL || left->count >= right->count)) {
+					this->rotate_right(left, node);
+					break;
+				}
+				else {
+					this->rotate_left(node, right);
+					break;
+				}
+				node = parent;
+			}
+			if (this->root_node_->count == 0) {
+				node_type* old_root = this->root_node_;
+				if (old_root->is_leaf) {
+					this->root_node_ = NULL;
+					this->leftmost_node_ = NULL;
+					this->rightmost_node_ = NULL;
+				}
+				else {
+					this->root_node_ = old_root->child(0);
+					this->root_node_->parent = NULL;
+					this->root_node_->position = 0;
+				}
+				this->delete_node(old_root);
+			}
+			return;
+		}
+
+		void merge_nodes(node_type* left, node_type* right)
+		{
+			node_type* parent = left->parent;
+			int position = left->position;
+			this->move_value(left, left->count, parent, position);
+			for (int i = 0; i < right->count; ++i) {
+				this->move_value(left, left->count + 1 + i, right, i);
+			}
+			if (left->is_leaf == false) {
+				for (int i = 0; i <= right->count; ++i) {
+					this->set_child(left, left->count + 1 + i, right->child(i));
+				}
+			}
+			left->count += 1 + right->count;
+			for (int i = position, last = parent->count - 1; i < last; ++i) {
+				this->move_value(parent, i, parent, i + 1);
+				this->set_child(parent, i + 1, parent->child(i + 2));
+			}
+			parent->count--;
+			if (right == this->rightmost_node_) {
+				this->rightmost_node_ = left;
+			}
+			this->delete_node(right);
+			return;
+		}
+
+		void rotate_right(node_type* left, node_type* node)
+		{
+			node_type* parent = node->parent;
+			int separator = node->position - 1;
+			for (int i = node->count; i > 0; --i) {
+				this->move_value(node, i, node, i - 1);
+			}
+			if (node->is_leaf == false) {
+				for (int i = node->count + 1; i > 0; --i) {
+					this->set_child(node, i, node->child(i - 1));
+				}
+				this->set_child(node, 0, left->child(left->count));
+			}
+			this->move_value(node, 0, parent, separator);
+			this->move_value(parent, separator, left, left->count - 1);
+			left->count--;
+			node->count++;
+			return;
+		}
+
+		void rotate_left(node_type* node, node_type* right)
+		{
+			node_type* parent = node->parent;
+			int separator = node->position;
+			this->move_value(node, node->count, parent, separator);
+			this->move_value(parent, separator, right, 0);
+			if (node->is_leaf == false) {
+				this->set_child(node, node->count + 1, right->child(0));
+			}
+			for (int i = 0, last = right->count - 1; i < last; ++i) {
+				this->move_value(right, i, right, i + 1);
+			}
+			if (right->is_leaf == false) {
+				for (int i = 0; i < right->count; ++i) {
+					this->set_child(right, i, right->child(i + 1));
+				}
+			}
+			node->count++;
+			right->count--;
+			return;
+		}
+
+		node_type* clone_node(node_type const* src, node_type* parent)
+		{
+			node_type* node = this->create_node(src->is_leaf);
+			node->parent = parent;
+			node->position = src->position;
+			for (int i = 0; i < src->count; ++i) {
+				this->alloc_.construct(&node->value(i), src->value(i));
+				node->count++;
+			}
+			if (src->is_leaf == false) {
+				for (int i = 0; i <= src->count; ++i) {
+					node->child(i) = this->clone_node(src->child(i), node);
+				}
+			}
+			return node;
+		}
+
+		void clear_node(node_type* node)
+		{
+			if (node->is_leaf == false) {
+				for (int i = 0; i <= node->count; ++i) {
+					this->clear_node(node->child(i));
+				}
+			}
+			for (int i = 0; i < node->count; ++i) {
+				this->alloc_.destroy(&node->value(i));
+			}
+			this->delete_node(node);
+			return;
+		}
+	};
+}
+
+#endif
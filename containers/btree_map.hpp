@@ -0,0 +1,345 @@
+#ifndef BTREE_MAP_HPP
+#define BTREE_MAP_HPP
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+#include "comparaison.hpp"
+
+#include "less.hpp"
+#include "pair.hpp"
+#include "key_of_value.hpp"
+#include "btree.hpp"
+
+namespace ft
+{
+	template < class Key, class T, class Compare = ft::less<Key>,
+			 class Alloc = std::allocator< ft::pair<Key const, T> > >
+	class btree_map
+	{
+	public:
+		typedef Key key_type;
+		typedef T mapped_type;
+		typedef ft::pair<key_type const, mapped_type> value_type;
+		typedef Compare key_compare;
+		class value_compare;
+		typedef Alloc allocator_type;
+		typedef typename allocator_type::reference reference;
+		typedef typename allocator_type::const_reference const_reference;
+		typedef typename allocator_type::pointer pointer;
+		typedef typename allocator_type::const_pointer const_pointer;
+
+	protected:
+		typedef ft::btree<key_type, value_type, ft::select_first<value_type>,
+				key_compare, allocator_type> tree_type;
+
+	public:
+		typedef typename tree_type::iterator iterator;
+		typedef typename tree_type::const_iterator const_iterator;
+		typedef typename tree_type::reverse_iterator reverse_iterator;
+		typedef typename tree_type::const_reverse_iterator const_reverse_iterator;
+		typedef typename tree_type::difference_type difference_type;
+		typedef typename tree_type::size_type size_type;
+
+		class value_compare
+		{
+		protected:
+			Compare comp_;
+
+		public:
+			typedef bool result_type;
+			typedef value_type first_argument_type;
+			typedef value_type second_argument_type;
+
+			value_compare(Compare c) :
+				comp_(c)
+			{
+				return;
+			}
+
+			bool operator()(value_type const& x, value_type const& y) const
+			{
+				return this->comp_(x.first, y.first);
+			}
+		};
+
+	protected:
+		tree_type tree_;
+
+	public:
+		explicit btree_map(key_compare const& comp = key_compare(),
+				allocator_type const& alloc = allocator_type()) :
+			tree_(comp, alloc)
+		{
+			return;
+		}
+
+		template <class InputIterator>
+		btree_map(InputIterator first, InputIterator last,
+				key_compare const& comp = key_compare(),
+				allocator_type const& alloc = allocator_type()) :
+			tree_(comp, alloc)
+		{
+			this->insert(first, last);
+			return;
+		}
+
+		btree_map(btree_map const& x) :
+			tree_(x.tree_)
+		{
+			return;
+		}
+
+		~btree_map()
+		{
+			return;
+		}
+
+		btree_map& operator=(btree_map const& x)
+		{
+			this->tree_ = x.tree_;
+			return *this;
+		}
+
+#if __cplusplus >= 201103L
+		btree_map(btree_map&& x) :
+			tree_(std::move(x.tree_))
+		{
+			return;
+		}
+
+		btree_map& operator=(btree_map&& x)
+		{
+			this->tree_ = std::move(x.tree_);
+			return *this;
+		}
+#endif
+
+		iterator begin()
+		{
+			return this->tree_.begin();
+		}
+
+		const_iterator begin() const
+		{
+			return this->tree_.begin();
+		}
+
+		iterator end()
+		{
+			return this->tree_.end();
+		}
+
+		const_iterator end() const
+		{
+			return this->tree_.end();
+		}
+
+		reverse_iterator rbegin()
+		{
+			return this->tree_.rbegin();
+		}
+
+		const_reverse_iterator rbegin() const
+		{
+			return this->tree_.rbegin();
+		}
+
+		reverse_iterator rend()
+		{
+			return this->tree_.rend();
+		}
+
+		const_reverse_iterator rend() const
+		{
+			return this->tree_.rend();
+		}
+
+		bool empty() const
+		{
+			return this->tree_.empty();
+		}
+
+		size_type size() const
+		{
+			return this->tree_.size();
+		}
+
+		size_type max_size() const
+		{
+			return this->tree_.max_size();
+		}
+
+		mapped_type& operator[](key_type const& k)
+		{
+			return (*((this->insert(value_type(k, mapped_type()))).first)).second;
+		}
+
+		ft::pair<iterator,bool> insert(value_type const& val)
+		{
+			return this->tree_.insert_unique(val);
+		}
+
+		iterator insert(iterator position, value_type const& val)
+		{
+			static_cast<void>(position);
+			return this->tree_.insert_unique(val).first;
+		}
+
+		template <class InputIterator>
+		void insert(InputIterator first, InputIterator last)
+		{
+			while (first != last) {
+				this->tree_.insert_unique(*first);
+				++first;
+			}
+			return;
+		}
+
+		void erase(iterator position)
+		{
+			this->tree_.erase(position);
+			return;
+		}
+
+		size_type erase(key_type const& k)
+		{
+			return this->tree_.erase_unique(k);
+		}
+
+		void erase(iterator first, iterator last)
+		{
+			this->tree_.erase(first, last);
+			return;
+		}
+
+		void swap(btree_map& x)
+		{
+			this->tree_.swap(x.tree_);
+			return;
+		}
+
+		void clear()
+		{
+			this->tree_.clear();
+			return;
+		}
+
+		key_compare key_comp() const
+		{
+			return this->tree_.key_comp();
+		}
+
+		value_compare value_comp() const
+		{
+			return value_compare(this->tree_.key_comp());
+		}
+
+		iterator find(key_type const& k)
+		{
+			return this->tree_.find(k);
+		}
+
+		const_iterator find(key_type const& k) const
+		{
+			return this->tree_.find(k);
+		}
+
+		size_type count(key_type const& k) const
+		{
+			return this->tree_.count(k);
+		}
+
+		iterator lower_bound(key_type const& k)
+		{
+			return this->tree_.lower_bound(k);
+		}
+
+		const_iterator lower_bound(key_type const& k) const
+		{
+			return this->tree_.lower_bound(k);
+		}
+
+		iterator upper_bound(key_type const& k)
+		{
+			return this->tree_.upper_bound(k);
+		}
+
+		const_iterator upper_bound(key_type const& k) const
+		{
+			return this->tree_.upper_bound(k);
+		}
+
+		pair<const_iterator,const_iterator> equal_range(key_type const& k) const
+		{
+			return this->tree_.equal_range(k);
+		}
+
+		pair<iterator,iterator> equal_range(key_type const& k)
+		{
+			return this->tree_.equal_range(k);
+		}
+
+		allocator_type get_allocator() const
+		{
+			return this->tree_.get_allocator();
+		}
+	};
+
+	template< class Key, class T, class Compare, class Alloc >
+	bool operator==(ft::btree_map<Key,T,Compare,Alloc> const& lhs,
+			ft::btree_map<Key,T,Compare,Alloc> const& rhs)
+	{
+		if (lhs.size() != rhs.size()) {
+			return false;
+		}
+		return ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+	}
+
+	template< class Key, class T, class Compare, class Alloc >
+	bool operator!=(ft::btree_map<Key,T,Compare,Alloc> const& lhs,
+			ft::btree_map<Key,T,Compare,Alloc> const& rhs)
+	{
+		return !(lhs == rhs);
+	}
+
+	template< class Key, class T, class Compare, class Alloc >
+	bool operator<(ft::btree_map<Key,T,Compare,Alloc> const& lhs,
+			ft::btree_map<Key,T,Compare,Alloc> const& rhs)
+	{
+		return ft::lexicographical_compare(lhs.begin(), lhs.end(),
+				rhs.begin(), rhs.end());
+	}
+
+	template< class Key, class T, class Compare, class Alloc >
+	bool operator<=(ft::btree_map<Key,T,Compare,Alloc> const& lhs,
+			ft::btree_map<Key,T,Compare,Alloc> const& rhs)
+	{
+		return !(rhs < lhs);
+	}
+
+	template< class Key, class T, class Compare, class Alloc >
+	bool operator>(ft::btree_map<Key,T,Compare,Alloc> const& lhs,
+			ft::btree_map<Key,T,Compare,Alloc> const& rhs)
+	{
+		return rhs < lhs;
+	}
+
+	template< class Key, class T, class Compare, class Alloc >
+	bool operator>=(ft::btree_map<Key,T,Compare,Alloc> const& lhs,
+			ft::btree_map<Key,T,Compare,Alloc> const& rhs)
+	{
+		return !(lhs < rhs);
+	}
+
+	template< class Key, class T, class Compare, class Alloc >
+	void swap(ft::btree_map<Key,T,Compare,Alloc>& lhs,
+			ft::btree_map<Key,T,Compare,Alloc>& rhs)
+	{
+		lhs.swap(rhs);
+		return;
+	}
+}
+
+#endif
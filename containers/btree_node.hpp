@@ -0,0 +1,146 @@
+#ifndef BTREE_NODE_HPP
+#define BTREE_NODE_HPP
+
+#include <cstdlib>
+
+namespace ft
+{
+	// Values are kept in raw storage and constructed by the tree allocator,
+	// internal nodes are leaves followed by their children pointers.
+	template <class ValueType>
+	class btree_node
+	{
+	public:
+		enum { target_node_size = 256 };
+		enum { header_size = sizeof(void*) + 2 * sizeof(unsigned short)
+			+ sizeof(bool) };
+		enum { max_values = (target_node_size - header_size)
+			/ sizeof(ValueType) < 3 ? 3
+			: (target_node_size - header_size) / sizeof(ValueType) };
+		enum { min_values = (max_values - 1) / 2 };
+
+		btree_node* parent;
+		unsigned short position;
+		unsigned short count;
+		bool is_leaf;
+
+	private:
+		union
+		{
+			char raw[max_values * sizeof(ValueType)];
+			long double align_long_double;
+			long long align_long_long;
+			void* align_pointer;
+		} values_;
+
+	public:
+		ValueType* values()
+		{
+			return reinterpret_cast<ValueType*>(this->values_.raw);
+		}
+
+		ValueType const* values() const
+		{
+			return reinterpret_cast<ValueType const*>(this->values_.raw);
+		}
+
+		ValueType& value(int i)
+		{
+			return this->values()[i];
+		}
+
+		ValueType const& value(int i) const
+		{
+			return this->values()[i];
+		}
+
+		btree_node*& child(int i);
+
+		btree_node* child(int i) const;
+
+		btree_node* get_leftmost_leaf()
+		{
+			btree_node* node = this;
+			while (node->is_leaf == false) {
+				node = node->child(0);
+			}
+			return node;
+		}
+
+		btree_node* get_rightmost_leaf()
+		{
+			btree_node* node = this;
+			while (node->is_leaf == false) {
+				node = node->child(node->count);
+			}
+			return node;
+		}
+
+		static void increment(btree_node*& node, int& position)
+		{
+			if (node->is_leaf == false) {
+				node = node->child(position + 1)->get_leftmost_leaf();
+				position = 0;
+				return;
+			}
+			position++;
+			if (position < node->count) {
+				return;
+			}
+			btree_node* end_node = node;
+			int end_position = position;
+			while (position == node->count && node->parent) {
+				position = node->position;
+				node = node->parent;
+			}
+			if (position == node->count) {
+				node = end_node;
+				position = end_position;
+			}
+		}
+
+		static void decrement(btree_node*& node, int& position)
+		{
+			if (node->is_leaf == false) {
+				node = node->child(position)->get_rightmost_leaf();
+				position = node->count - 1;
+				return;
+			}
+			position--;
+			if (position >= 0) {
+				return;
+			}
+			btree_node* begin_node = node;
+			while (position < 0 && node->parent) {
+				position = node->position - 1;
+				node = node->parent;
+			}
+			if (position < 0) {
+				node = begin_node;
+				position = 0;
+			}
+		}
+	};
+
+	template <class ValueType>
+	class btree_internal_node : public btree_node<ValueType>
+	{
+	public:
+		btree_node<ValueType>* children[btree_node<ValueType>::max_values + 1];
+	};
+
+	template <class ValueType>
+	btree_node<ValueType>*& btree_node<ValueType>::child(int i)
+	{
+		return static_cast<btree_internal_node<ValueType>*>(this)->children[i];
+	}
+
+	template <class ValueType>
+	btree_node<ValueType>* btree_node<ValueType>::child(int i) const
+	{
+		return static_cast<btree_internal_node<ValueType> const*>(this)
+			->children[i];
+	}
+}
+
+#endif
@@ -0,0 +1,284 @@
+#ifndef BTREE_SET_HPP
+#define BTREE_SET_HPP
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+#include "comparaison.hpp"
+
+#include "less.hpp"
+#include "pair.hpp"
+#include "key_of_value.hpp"
+#include "btree.hpp"
+
+namespace ft
+{
+	template < class T, class Compare = less<T>, class Alloc = std::allocator<T> >
+	class btree_set
+	{
+	public:
+		typedef T key_type;
+		typedef T value_type;
+		typedef Compare key_compare;
+		typedef Compare value_compare;
+		typedef Alloc allocator_type;
+		typedef typename allocator_type::reference reference;
+		typedef typename allocator_type::const_reference const_reference;
+		typedef typename allocator_type::pointer pointer;
+		typedef typename allocator_type::const_pointer const_pointer;
+
+	protected:
+		typedef ft::btree<key_type, value_type, ft::identity<value_type>,
+				key_compare, allocator_type> tree_type;
+
+	public:
+		typedef typename tree_type::const_iterator const_iterator;
+		typedef const_iterator iterator;
+		typedef typename tree_type::const_reverse_iterator const_reverse_iterator;
+		typedef const_reverse_iterator reverse_iterator;
+		typedef typename tree_type::difference_type difference_type;
+		typedef typename tree_type::size_type size_type;
+
+	protected:
+		tree_type tree_;
+
+	public:
+		explicit btree_set(key_compare const& comp = key_compare(),
+				allocator_type const& alloc = allocator_type()) :
+			tree_(comp, alloc)
+		{
+			return;
+		}
+
+		template <class InputIterator>
+		btree_set(InputIterator first, InputIterator last,
+				key_compare const& comp = key_compare(),
+				allocator_type const& alloc = allocator_type()) :
+			tree_(comp, alloc)
+		{
+			this->insert(first, last);
+			return;
+		}
+
+		btree_set(btree_set const& x) :
+			tree_(x.tree_)
+		{
+			return;
+		}
+
+		~btree_set()
+		{
+			return;
+		}
+
+		btree_set& operator=(btree_set const& x)
+		{
+			this->tree_ = x.tree_;
+			return *this;
+		}
+
+#if __cplusplus >= 201103L
+		btree_set(btree_set&& x) :
+			tree_(std::move(x.tree_))
+		{
+			return;
+		}
+
+		btree_set& operator=(btree_set&& x)
+		{
+			this->tree_ = std::move(x.tree_);
+			return *this;
+		}
+#endif
+
+		iterator begin() const
+		{
+			return this->tree_.begin();
+		}
+
+		iterator end() const
+		{
+			return this->tree_.end();
+		}
+
+		reverse_iterator rbegin() const
+		{
+			return this->tree_.rbegin();
+		}
+
+		reverse_iterator rend() const
+		{
+			return this->tree_.rend();
+		}
+
+		bool empty() const
+		{
+			return this->tree_.empty();
+		}
+
+		size_type size() const
+		{
+			return this->tree_.size();
+		}
+
+		size_type max_size() const
+		{
+			return this->tree_.max_size();
+		}
+
+		pair<iterator,bool> insert(value_type const& val)
+		{
+			ft::pair<typename tree_type::iterator,bool> result
+				= this->tree_.insert_unique(val);
+			return ft::pair<iterator,bool>(result.first, result.second);
+		}
+
+		iterator insert(iterator position, value_type const& val)
+		{
+			static_cast<void>(position);
+			return this->tree_.insert_unique(val).first;
+		}
+
+		template <class InputIterator>
+		void insert(InputIterator first, InputIterator last)
+		{
+			while (first != last) {
+				this->tree_.insert_unique(*first);
+				++first;
+			}
+			return;
+		}
+
+		void erase(iterator position)
+		{
+			this->tree_.erase(this->to_tree_iterator(position));
+			return;
+		}
+
+		size_type erase(value_type const& val)
+		{
+			return this->tree_.erase_unique(val);
+		}
+
+		void erase(iterator first, iterator last)
+		{
+			this->tree_.erase(this->to_tree_iterator(first),
+					this->to_tree_iterator(last));
+			return;
+		}
+
+		void swap(btree_set& x)
+		{
+			this->tree_.swap(x.tree_);
+			return;
+		}
+
+		void clear()
+		{
+			this->tree_.clear();
+			return;
+		}
+
+		key_compare key_comp() const
+		{
+			return this->tree_.key_comp();
+		}
+
+		value_compare value_comp() const
+		{
+			return this->tree_.key_comp();
+		}
+
+		iterator find(value_type const& val) const
+		{
+			return this->tree_.find(val);
+		}
+
+		size_type count(value_type const& val) const
+		{
+			return this->tree_.count(val);
+		}
+
+		iterator lower_bound(value_type const& val) const
+		{
+			return this->tree_.lower_bound(val);
+		}
+
+		iterator upper_bound(value_type const& val) const
+		{
+			return this->tree_.upper_bound(val);
+		}
+
+		pair<iterator,iterator> equal_range(value_type const& val) const
+		{
+			return this->tree_.equal_range(val);
+		}
+
+		allocator_type get_allocator() const
+		{
+			return this->tree_.get_allocator();
+		}
+
+	private:
+		typename tree_type::iterator to_tree_iterator(iterator it) const
+		{
+			return typename tree_type::iterator(it.node_, it.position_);
+		}
+	};
+
+	template<class T, class Compare, class Alloc>
+	bool operator==(btree_set<T, Compare, Alloc> const& lhs,
+			btree_set<T, Compare, Alloc> const& rhs)
+	{
+		if (lhs.size() != rhs.size()) {
+			return false;
+		}
+		return ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+	}
+
+	template<class T, class Compare, class Alloc>
+	bool operator!=(btree_set<T, Compare, Alloc> const& lhs,
+			btree_set<T, Compare, Alloc> const& rhs)
+	{
+		return !(lhs == rhs);
+	}
+
+	template<class T, class Compare, class Alloc>
+	bool operator<(btree_set<T, Compare, Alloc> const& lhs,
+			btree_set<T, Compare, Alloc> const& rhs)
+	{
+		return ft::lexicographical_compare(lhs.begin(), lhs.end(),
+				rhs.begin(), rhs.end());
+	}
+
+	template<class T, class Compare, class Alloc>
+	bool operator<=(btree_set<T, Compare, Alloc> const& lhs,
+			btree_set<T, Compare, Alloc> const& rhs)
+	{
+		return !(rhs < lhs);
+	}
+
+	template<class T, class Compare, class Alloc>
+	bool operator>(btree_set<T, Compare, Alloc> const& lhs,
+			btree_set<T, Compare, Alloc> const& rhs)
+	{
+		return rhs < lhs;
+	}
+
+	template<class T, class Compare, class Alloc>
+	bool operator>=(btree_set<T, Compare, Alloc> const& lhs,
+			btree_set<T, Compare, Alloc> const& rhs)
+	{
+		return !(lhs < rhs);
+	}
+
+	template<class T, class Compare, class Alloc>
+	void swap(btree_set<T, Compare, Alloc>& lhs, btree_set<T, Compare, Alloc>& rhs)
+	{
+		lhs.swap(rhs);
+		return;
+	}
+}
+
+#endif
@@ -1,11 +1,68 @@
 #ifndef COMPARAISON_HPP
 #define COMPARAISON_HPP
 
+#include <cstddef>
+#include <cstring>
+
+#if defined(__SSE2__)
+# include <emmintrin.h>
+#endif
+
+#include "enable_if.hpp"
+#include "iterator_traits.hpp"
+
 namespace ft
 {
+	// Offset of the first differing byte of two buffers of n bytes, or n.
+	inline std::size_t first_difference(void const* buffer1,
+			void const* buffer2, std::size_t n)
+	{
+		unsigned char const* bytes1 = static_cast<unsigned char const*>(buffer1);
+		unsigned char const* bytes2 = static_cast<unsigned char const*>(buffer2);
+		std::size_t i = 0;
+#if defined(__SSE2__)
+		for (; i + 16 <= n; i += 16) {
+			__m128i x = _mm_loadu_si128(reinterpret_cast<__m128i const*>(
+						bytes1 + i));
+			__m128i y = _mm_loadu_si128(reinterpret_cast<__m128i const*>(
+						bytes2 + i));
+			unsigned int mask = _mm_movemask_epi8(_mm_cmpeq_epi8(x, y)) ^ 0xffff;
+			if (mask != 0) {
+				return i + __builtin_ctz(mask);
+			}
+		}
+#else
+		for (; i + sizeof(unsigned long) <= n; i += sizeof(unsigned long)) {
+			unsigned long x;
+			unsigned long y;
+			std::memcpy(&x, bytes1 + i, sizeof(x));
+			std::memcpy(&y, bytes2 + i, sizeof(y));
+			if (x != y) {
+				break;
+			}
+		}
+#endif
+		while (i < n && bytes1[i] == bytes2[i]) {
+			++i;
+		}
+		return i;
+	}
+
+	// Integral values have no padding, so equal ranges are equal bytes.
+	template <class T>
+	bool equal_memory(T const* first1, T const* last1, T const* first2)
+	{
+		if (first1 == last1) {
+			return true;
+		}
+		return std::memcmp(first1, first2, (last1 - first1) * sizeof(T)) == 0;
+	}
+
 	template <class InputIterator1, class InputIterator2>
-	bool equal(InputIterator1 first1, InputIterator1 last1,
-			InputIterator2 first2)
+	typename ft::enable_if<!ft::is_memory_compatible<InputIterator1,
+		InputIterator2>::value && !ft::is_reversed_contiguous_pair<
+		InputIterator1, InputIterator2>::value, bool>::type
+	equal(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2)
 	{
 		while (first1 != last1) {
 			if (!(*first1 == *first2)) {
@@ -17,6 +74,37 @@ namespace ft
 		return true;
 	}
 
+	template <class InputIterator1, class InputIterator2>
+	typename ft::enable_if<ft::is_memory_compatible<InputIterator1,
+		InputIterator2>::value, bool>::type
+	equal(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2)
+	{
+		typedef ft::contiguous_iterator_traits<InputIterator1> traits1;
+		typedef ft::contiguous_iterator_traits<InputIterator2> traits2;
+		return ft::equal_memory(traits1::address(first1),
+				traits1::address(last1), traits2::address(first2));
+	}
+
+	// Reverse iterators over contiguous storage are unwrapped, to skip the
+	// copy and decrement of their base on each dereference.
+	template <class InputIterator1, class InputIterator2>
+	typename ft::enable_if<ft::is_reversed_contiguous_pair<InputIterator1,
+		InputIterator2>::value, bool>::type
+	equal(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2)
+	{
+		typedef ft::contiguous_iterator_traits<InputIterator1> traits1;
+		typedef ft::contiguous_iterator_traits<InputIterator2> traits2;
+		typename traits1::pointer it1 = traits1::address(first1);
+		typename traits1::pointer ite1 = traits1::address(last1);
+		typename traits2::pointer it2 = traits2::address(first2);
+		while (it1 != ite1) {
+			if (!(*traits1::next(it1) == *traits2::next(it2))) {
+				return false;
+			}
+		}
+		return true;
+	}
+
 	template <class InputIterator1, class InputIterator2, class BinaryPredicate>
 	bool equal(InputIterator1 first1, InputIterator1 last1,
 			InputIterator2 first2, BinaryPredicate pred)
@@ -33,7 +121,9 @@ namespace ft
 	}
 
 	template <class InputIterator1, class InputIterator2>
-	bool lexicographical_compare(InputIterator1 first1, InputIterator1 last1,
+	typename ft::enable_if<!ft::is_memory_compatible<InputIterator1,
+		InputIterator2>::value, bool>::type
+	lexicographical_compare(InputIterator1 first1, InputIterator1 last1,
 			InputIterator2 first2, InputIterator2 last2)
 	{
 		while (first1 != last1 && first2 != last2) {
@@ -65,6 +155,83 @@ namespace ft
 		}
 		return first2 != last2;
 	}
+
+	// Negative, zero or positive as [first1, last1) orders before, like or
+	// after [first2, last2), so each relational operator is a single pass.
+	template <class InputIterator1, class InputIterator2>
+	typename ft::enable_if<!ft::is_memory_compatible<InputIterator1,
+		InputIterator2>::value, int>::type
+	lexicographical_compare_three_way(InputIterator1 first1,
+			InputIterator1 last1, InputIterator2 first2, InputIterator2 last2)
+	{
+		while (first1 != last1 && first2 != last2) {
+			if (*first1 < *first2) {
+				return -1;
+			}
+			else if (*first2 < *first1) {
+				return 1;
+			}
+			++first1;
+			++first2;
+		}
+		if (first2 != last2) {
+			return -1;
+		}
+		return first1 != last1;
+	}
+
+	// memcmp orders unsigned bytes like their values, the other integral
+	// ranges are scanned for their first differing element.
+	template <class T>
+	int compare_memory(T const* first1, T const* last1,
+			T const* first2, T const* last2)
+	{
+		std::size_t size1 = last1 - first1;
+		std::size_t size2 = last2 - first2;
+		std::size_t size = size1 < size2 ? size1 : size2;
+		if (size != 0) {
+			if (sizeof(T) == 1 && static_cast<T>(-1) > static_cast<T>(0)) {
+				int result = std::memcmp(first1, first2, size);
+				if (result != 0) {
+					return result;
+				}
+			}
+			else {
+				std::size_t i = ft::first_difference(first1, first2,
+						size * sizeof(T)) / sizeof(T);
+				if (i != size) {
+					return first1[i] < first2[i] ? -1 : 1;
+				}
+			}
+		}
+		if (size1 < size2) {
+			return -1;
+		}
+		return size1 != size2;
+	}
+
+	template <class InputIterator1, class InputIterator2>
+	typename ft::enable_if<ft::is_memory_compatible<InputIterator1,
+		InputIterator2>::value, int>::type
+	lexicographical_compare_three_way(InputIterator1 first1,
+			InputIterator1 last1, InputIterator2 first2, InputIterator2 last2)
+	{
+		typedef ft::contiguous_iterator_traits<InputIterator1> traits1;
+		typedef ft::contiguous_iterator_traits<InputIterator2> traits2;
+		return ft::compare_memory(traits1::address(first1),
+				traits1::address(last1), traits2::address(first2),
+				traits2::address(last2));
+	}
+
+	template <class InputIterator1, class InputIterator2>
+	typename ft::enable_if<ft::is_memory_compatible<InputIterator1,
+		InputIterator2>::value, bool>::type
+	lexicographical_compare(InputIterator1 first1, InputIterator1 last1,
+			InputIterator2 first2, InputIterator2 last2)
+	{
+		return ft::lexicographical_compare_three_way(first1, last1,
+				first2, last2) < 0;
+	}
 }
 
 #endif
@@ -0,0 +1,220 @@
+#ifndef CONCURRENT_STACK_HPP
+#define CONCURRENT_STACK_HPP
+
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <stdint.h>
+
+namespace ft
+{
+	// Lock-free stack (Treiber) that threads can push to and pop from
+	// concurrently. The head pointer carries a modification count in its
+	// unused high bits, so a pop fails on a head that was popped and pushed
+	// back meanwhile (ABA), unless the count wrapped around in between.
+	// Popped nodes are kept in a lock-free pool for the next pushes and only
+	// freed by the destructor, which makes reading a concurrently popped node
+	// safe.
+	template < class T, class Alloc = std::allocator<T> >
+	class concurrent_stack
+	{
+	public:
+		typedef T value_type;
+		typedef Alloc allocator_type;
+		typedef std::size_t size_type;
+
+	protected:
+		struct node
+		{
+			node* next;
+			value_type val;
+		};
+
+		typedef typename allocator_type::template rebind<node>::other
+			node_allocator_type;
+		typedef unsigned long long tagged_ptr;
+
+		// The count takes the bits above tag_shift, which assumes the node
+		// addresses fit in 48 bits on 64 bit targets. It is not true of 57 bit
+		// addresses (5-level paging) nor of pointers tagged in their top byte,
+		// push throws std::length_error on a node that does not fit.
+		enum
+		{
+			tag_shift = sizeof(void*) == 8 ? 48 : 32
+		};
+
+		// head_, pool_ and size_ are written by every operation, they are
+		// kept on their own cache lines.
+		tagged_ptr head_;
+		char head_padding_[64];
+		tagged_ptr pool_;
+		char pool_padding_[64];
+		size_type size_;
+		char size_padding_[64];
+		allocator_type alloc_;
+		node_allocator_type node_alloc_;
+
+	public:
+		explicit concurrent_stack(allocator_type const& alloc = allocator_type()) :
+			head_(0),
+			pool_(0),
+			size_(0),
+			alloc_(alloc),
+			node_alloc_(alloc)
+		{
+			return;
+		}
+
+		~concurrent_stack()
+		{
+			node* n = get_node(this->head_);
+			while (n != NULL) {
+				node* next = n->next;
+				this->alloc_.destroy(&n->val);
+				this->node_alloc_.deallocate(n, 1);
+				n = next;
+			}
+			n = get_node(this->pool_);
+			while (n != NULL) {
+				node* next = n->next;
+				this->node_alloc_.deallocate(n, 1);
+				n = next;
+			}
+			return;
+		}
+
+		bool empty() const
+		{
+			return get_node(__atomic_load_n(&this->head_, __ATOMIC_ACQUIRE))
+				== NULL;
+		}
+
+		// Exact when no other thread is pushing or popping.
+		size_type size() const
+		{
+			return __atomic_load_n(&this->size_, __ATOMIC_RELAXED);
+		}
+
+		// A copy of the top element, the stack must not be empty. The top
+		// element must not be popped meanwhile, concurrent consumers use
+		// try_pop instead.
+		value_type top() const
+		{
+			return get_node(__atomic_load_n(&this->head_, __ATOMIC_ACQUIRE))->val;
+		}
+
+		void push(value_type const& val)
+		{
+			node* n = pop_node(this->pool_);
+			if (n == NULL) {
+				n = this->node_alloc_.allocate(1);
+				if (static_cast<tagged_ptr>(reinterpret_cast<uintptr_t>(n))
+						>> tag_shift != 0) {
+					this->node_alloc_.deallocate(n, 1);
+					throw std::length_error("concurrent_stack::push");
+				}
+			}
+			try {
+				this->alloc_.construct(&n->val, val);
+			}
+			catch (...) {
+				push_node(this->pool_, n);
+				throw;
+			}
+			__atomic_add_fetch(&this->size_, 1, __ATOMIC_RELAXED);
+			push_node(this->head_, n);
+			return;
+		}
+
+		// Does nothing on an empty stack.
+		void pop()
+		{
+			node* n = pop_node(this->head_);
+			if (n != NULL) {
+				this->release_node(n);
+			}
+			return;
+		}
+
+		// Pops the top element into val, false when the stack is empty.
+		bool try_pop(value_type& val)
+		{
+			node* n = pop_node(this->head_);
+			if (n == NULL) {
+				return false;
+			}
+			try {
+				val = n->val;
+			}
+			catch (...) {
+				this->release_node(n);
+				throw;
+			}
+			this->release_node(n);
+			return true;
+		}
+
+		allocator_type get_allocator() const
+		{
+			return this->alloc_;
+		}
+
+	protected:
+		static node* get_node(tagged_ptr head)
+		{
+			return reinterpret_cast<node*>(static_cast<uintptr_t>(
+						head & ((1ULL << tag_shift) - 1)));
+		}
+
+		// The pointer n tagged with the count of head plus one.
+		static tagged_ptr make_head(node* n, tagged_ptr head)
+		{
+			return (((head >> tag_shift) + 1) << tag_shift)
+				| static_cast<tagged_ptr>(reinterpret_cast<uintptr_t>(n));
+		}
+
+		static void push_node(tagged_ptr& head, node* n)
+		{
+			tagged_ptr expected = __atomic_load_n(&head, __ATOMIC_RELAXED);
+			do {
+				__atomic_store_n(&n->next, get_node(expected), __ATOMIC_RELAXED);
+			} while (__atomic_compare_exchange_n(&head, &expected,
+						make_head(n, expected), true, __ATOMIC_RELEASE,
+						__ATOMIC_RELAXED) == false);
+			return;
+		}
+
+		// The next pointer of a node popped by another thread can be read,
+		// the changed tag then fails the exchange.
+		static node* pop_node(tagged_ptr& head)
+		{
+			tagged_ptr expected = __atomic_load_n(&head, __ATOMIC_ACQUIRE);
+			while (1) {
+				node* n = get_node(expected);
+				if (n == NULL) {
+					return NULL;
+				}
+				node* next = __atomic_load_n(&n->next, __ATOMIC_RELAXED);
+				if (__atomic_compare_exchange_n(&head, &expected,
+							make_head(next, expected), true, __ATOMIC_ACQUIRE,
+							__ATOMIC_ACQUIRE) == true) {
+					return n;
+				}
+			}
+		}
+
+		void release_node(node* n)
+		{
+			this->alloc_.destroy(&n->val);
+			__atomic_sub_fetch(&this->size_, 1, __ATOMIC_RELAXED);
+			push_node(this->pool_, n);
+			return;
+		}
+
+	private:
+		concurrent_stack(concurrent_stack const& src);
+		concurrent_stack& operator=(concurrent_stack const& rhs);
+	};
+}
+
+#endif
@@ -14,6 +14,28 @@ namespace ft
 		typedef T type;
 	};
 
+	template<class T, class U>
+	struct is_same
+	{
+		static bool const value = false;
+	};
+	template<class T>
+	struct is_same<T, T>
+	{
+		static bool const value = true;
+	};
+
+	template<class T>
+	struct remove_const
+	{
+		typedef T type;
+	};
+	template<class T>
+	struct remove_const<T const>
+	{
+		typedef T type;
+	};
+
 	template<class T>
 	struct is_integral
 	{
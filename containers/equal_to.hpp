@@ -0,0 +1,20 @@
+#ifndef EQUAL_TO_HPP
+#define EQUAL_TO_HPP
+
+namespace ft
+{
+	template <class T>
+	struct equal_to
+	{
+		typedef T first_argument_type;
+		typedef T second_argument_type;
+		typedef bool result_type;
+
+		bool operator()(T const& x, T const& y) const
+		{
+			return x == y;
+		}
+	};
+}
+
+#endif
@@ -0,0 +1,459 @@
+#ifndef FLAT_TREE_HPP
+#define FLAT_TREE_HPP
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+#include "pair.hpp"
+#include "vector.hpp"
+
+namespace ft
+{
+	// Ordered unique-key storage shared by flat_map and flat_set, values are
+	// kept sorted in a single ft::vector. Insert and erase are linear and
+	// invalidate every iterator, lookups are binary searches.
+	template <class Key, class Value, class KeyOfValue, class Compare,
+			 class Alloc>
+	class flat_tree
+	{
+	public:
+		typedef Key key_type;
+		typedef Value value_type;
+		typedef Compare key_compare;
+		typedef Alloc allocator_type;
+		typedef ft::vector<value_type, allocator_type> vector_type;
+		typedef typename vector_type::iterator iterator;
+		typedef typename vector_type::const_iterator const_iterator;
+		typedef typename vector_type::reverse_iterator reverse_iterator;
+		typedef typename vector_type::const_reverse_iterator
+			const_reverse_iterator;
+		typedef typename vector_type::difference_type difference_type;
+		typedef typename vector_type::size_type size_type;
+
+	protected:
+		typedef typename allocator_type::template rebind<value_type const*>::other
+			pointer_allocator_type;
+		typedef ft::vector<value_type const*, pointer_allocator_type>
+			pointer_vector_type;
+
+		enum { insertion_sort_run = 16 };
+
+		key_compare comp_;
+		vector_type values_;
+
+	public:
+		explicit flat_tree(key_compare const& comp = key_compare(),
+				allocator_type const& alloc = allocator_type()) :
+			comp_(comp),
+			values_(alloc)
+		{
+			return;
+		}
+
+		flat_tree(flat_tree const& x) :
+			comp_(x.comp_),
+			values_(x.values_)
+		{
+			return;
+		}
+
+		~flat_tree()
+		{
+			return;
+		}
+
+		flat_tree& operator=(flat_tree const& x)
+		{
+			this->comp_ = x.comp_;
+			this->values_ = x.values_;
+			return *this;
+		}
+
+#if __cplusplus >= 201103L
+		flat_tree(flat_tree&& x) :
+			comp_(x.comp_),
+			values_(std::move(x.values_))
+		{
+			return;
+		}
+
+		flat_tree& operator=(flat_tree&& x)
+		{
+			this->comp_ = x.comp_;
+			this->values_ = std::move(x.values_);
+			return *this;
+		}
+#endif
+
+		iterator begin()
+		{
+			return this->values_.begin();
+		}
+
+		const_iterator begin() const
+		{
+			return this->values_.begin();
+		}
+
+		iterator end()
+		{
+			return this->values_.end();
+		}
+
+		const_iterator end() const
+		{
+			return this->values_.end();
+		}
+
+		reverse_iterator rbegin()
+		{
+			return this->values_.rbegin();
+		}
+
+		const_reverse_iterator rbegin() const
+		{
+			return this->values_.rbegin();
+		}
+
+		reverse_iterator rend()
+		{
+			return this->values_.rend();
+		}
+
+		const_reverse_iterator rend() const
+		{
+			return this->values_.rend();
+		}
+
+		bool empty() const
+		{
+			return this->values_.empty();
+		}
+
+		size_type size() const
+		{
+			return this->values_.size();
+		}
+
+		size_type max_size() const
+		{
+			return this->values_.max_size();
+		}
+
+		size_type capacity() const
+		{
+			return this->values_.capacity();
+		}
+
+		void reserve(size_type n)
+		{
+			this->values_.reserve(n);
+			return;
+		}
+
+		ft::pair<iterator,bool> insert_unique(value_type const& val)
+		{
+			key_type const& key = KeyOfValue()(val);
+			size_type index = this->lower_bound_index(key);
+			if (index != this->values_.size()
+					&& this->comp_(key, KeyOfValue()(this->values_[index]))
+					== false) {
+				return ft::pair<iterator,bool>(this->values_.begin() + index,
+						false);
+			}
+			return ft::pair<iterator,bool>(
+					this->values_.insert(this->values_.begin() + index, val),
+					true);
+		}
+
+		iterator insert_unique(const_iterator position, value_type const& val)
+		{
+			key_type const& key = KeyOfValue()(val);
+			if ((position == this->values_.end()
+						|| this->comp_(key, KeyOfValue()(*position)) == true)
+					&& (position == this->values_.begin()
+						|| this->comp_(KeyOfValue()(*(position - 1)), key)
+						== true)) {
+				return this->values_.insert(this->to_iterator(position), val);
+			}
+			return this->insert_unique(val).first;
+		}
+
+		// Sorts the new values on their own then merges them with the current
+		// ones, O(n + k log k) instead of k linear inserts. As with repeated
+		// insert_unique, the first of several equivalent values is kept.
+		template <class InputIterator>
+		void insert_unique(InputIterator first, InputIterator last)
+		{
+			vector_type staging(first, last, this->values_.get_allocator());
+			if (staging.empty() == true) {
+				return;
+			}
+			pointer_vector_type sorted(staging.size(), NULL);
+			for (size_type i = 0, size = staging.size(); i < size; ++i) {
+				sorted[i] = &staging[i];
+			}
+			this->sort_pointers(sorted);
+			vector_type result(this->values_.get_allocator());
+			result.reserve(this->values_.size() + staging.size());
+			size_type i = 0;
+			size_type size = this->values_.size();
+			for (size_type j = 0, sorted_size = sorted.size(); j < sorted_size;
+					++j) {
+				key_type const& key = KeyOfValue()(*sorted[j]);
+				while (i < size && this->comp_(KeyOfValue()(this->values_[i]),
+							key) == true) {
+					result.push_back(this->values_[i]);
+					i++;
+				}
+				if (i < size && this->comp_(key,
+							KeyOfValue()(this->values_[i])) == false) {
+					continue;
+				}
+				if (result.empty() == false
+						&& this->comp_(KeyOfValue()(result.back()), key) == false) {
+					continue;
+				}
+				result.push_back(*sorted[j]);
+			}
+			while (i < size) {
+				result.push_back(this->values_[i]);
+				i++;
+			}
+			this->values_.swap(result);
+			return;
+		}
+
+		template <class InputIterator>
+		void build(InputIterator first, InputIterator last)
+		{
+			this->values_.clear();
+			this->insert_unique(first, last);
+			return;
+		}
+
+		iterator erase(const_iterator position)
+		{
+			return this->values_.erase(this->to_iterator(position));
+		}
+
+		size_type erase_unique(key_type const& k)
+		{
+			size_type index = this->lower_bound_index(k);
+			if (index == this->values_.size()
+					|| this->comp_(k, KeyOfValue()(this->values_[index]))
+					== true) {
+				return 0;
+			}
+			this->values_.erase(this->values_.begin() + index);
+			return 1;
+		}
+
+		iterator erase(const_iterator first, const_iterator last)
+		{
+			return this->values_.erase(this->to_iterator(first),
+					this->to_iterator(last));
+		}
+
+		void swap(flat_tree& x)
+		{
+			key_compare comp_tmp = this->comp_;
+			this->comp_ = x.comp_;
+			x.comp_ = comp_tmp;
+			this->values_.swap(x.values_);
+			return;
+		}
+
+		void clear()
+		{
+			this->values_.clear();
+			return;
+		}
+
+		key_compare key_comp() const
+		{
+			return this->comp_;
+		}
+
+		iterator find(key_type const& k)
+		{
+			size_type index = this->lower_bound_index(k);
+			if (index == this->values_.size()
+					|| this->comp_(k, KeyOfValue()(this->values_[index]))
+					== true) {
+				return this->values_.end();
+			}
+			return this->values_.begin() + index;
+		}
+
+		const_iterator find(key_type const& k) const
+		{
+			size_type index = this->lower_bound_index(k);
+			if (index == this->values_.size()
+					|| this->comp_(k, KeyOfValue()(this->values_[index]))
+					== true) {
+				return this->values_.end();
+			}
+			return this->values_.begin() + index;
+		}
+
+		size_type count(key_type const& k) const
+		{
+			if (this->find(k) == this->values_.end()) {
+				return 0;
+			}
+			return 1;
+		}
+
+		iterator lower_bound(key_type const& k)
+		{
+			return this->values_.begin() + this->lower_bound_index(k);
+		}
+
+		const_iterator lower_bound(key_type const& k) const
+		{
+			return this->values_.begin() + this->lower_bound_index(k);
+		}
+
+		iterator upper_bound(key_type const& k)
+		{
+			return this->values_.begin() + this->upper_bound_index(k);
+		}
+
+		const_iterator upper_bound(key_type const& k) const
+		{
+			return this->values_.begin() + this->upper_bound_index(k);
+		}
+
+		ft::pair<iterator,iterator> equal_range(key_type const& k)
+		{
+			iterator it = this->find(k);
+			if (it == this->values_.end()) {
+				it = this->lower_bound(k);
+				return ft::pair<iterator,iterator>(it, it);
+			}
+			return ft::pair<iterator,iterator>(it, it + 1);
+		}
+
+		ft::pair<const_iterator,const_iterator> equal_range(
+				key_type const& k) const
+		{
+			const_iterator it = this->find(k);
+			if (it == this->values_.end()) {
+				it = this->lower_bound(k);
+				return ft::pair<const_iterator,const_iterator>(it, it);
+			}
+			return ft::pair<const_iterator,const_iterator>(it, it + 1);
+		}
+
+		allocator_type get_allocator() const
+		{
+			return this->values_.get_allocator();
+		}
+
+	private:
+		iterator to_iterator(const_iterator position)
+		{
+			return this->values_.begin() + (position - this->values_.begin());
+		}
+
+		size_type lower_bound_index(key_type const& k) const
+		{
+			size_type first = 0;
+			size_type count = this->values_.size();
+			while (count > 0) {
+				size_type half = count / 2;
+				if (this->comp_(KeyOfValue()(this->values_[first + half]), k)
+						== true) {
+					first += half + 1;
+					count -= half + 1;
+				}
+				else {
+					count = half;
+				}
+			}
+			return first;
+		}
+
+		size_type upper_bound_index(key_type const& k) const
+		{
+			size_type first = 0;
+			size_type count = this->values_.size();
+			while (count > 0) {
+				size_type half = count / 2;
+				if (this->comp_(k, KeyOfValue()(this->values_[first + half]))
+						== false) {
+					first += half + 1;
+					count -= half + 1;
+				}
+				else {
+					count = half;
+				}
+			}
+			return first;
+		}
+
+		bool pointer_less(value_type const* lhs, value_type const* rhs) const
+		{
+			return this->comp_(KeyOfValue()(*lhs), KeyOfValue()(*rhs));
+		}
+
+		// Stable bottom-up merge sort, pointers are sorted instead of the
+		// values so keys do not need to be assignable.
+		void sort_pointers(pointer_vector_type& pointers) const
+		{
+			size_type size = pointers.size();
+			for (size_type begin = 0; begin < size;
+					begin += insertion_sort_run) {
+				size_type end = begin + insertion_sort_run;
+				if (end > size) {
+					end = size;
+				}
+				for (size_type i = begin + 1; i < end; ++i) {
+					value_type const* tmp = pointers[i];
+					size_type j = i;
+					while (j > begin && this->pointer_less(tmp, pointers[j - 1])
+							== true) {
+						pointers[j] = pointers[j - 1];
+						j--;
+					}
+					pointers[j] = tmp;
+				}
+			}
+			if (size <= insertion_sort_run) {
+				return;
+			}
+			pointer_vector_type buffer(size, NULL);
+			for (size_type width = insertion_sort_run; width < size;
+					width *= 2) {
+				for (size_type left = 0; left < size; left += 2 * width) {
+					size_type middle = left + width < size ? left + width : size;
+					size_type right = middle + width < size ? middle + width
+						: size;
+					size_type i = left;
+					size_type j = middle;
+					size_type k = left;
+					while (i < middle && j < right) {
+						if (this->pointer_less(pointers[j], pointers[i]) == true) {
+							buffer[k++] = pointers[j++];
+						}
+						else {
+							buffer[k++] = pointers[i++];
+						}
+					}
+					while (i < middle) {
+						buffer[k++] = pointers[i++];
+					}
+					while (j < right) {
+						buffer[k++] = pointers[j++];
+					}
+				}
+				pointers.swap(buffer);
+			}
+			return;
+		}
+	};
+}
+
+#endif
@@ -0,0 +1,80 @@
+#ifndef HASH_HPP
+#define HASH_HPP
+
+#include <cstddef>
+#include <string>
+
+namespace ft
+{
+	// Spreads the bits of integral keys so that sequential keys do not map
+	// to sequential buckets or shards.
+	inline std::size_t hash_mix(std::size_t x)
+	{
+		x ^= x >> 16;
+		x *= 0x85ebca6bUL;
+		x ^= x >> 13;
+		x *= 0xc2b2ae35UL;
+		x ^= x >> 16;
+		return x;
+	}
+
+	template <class T>
+	struct hash;
+
+	template <class T>
+	struct integral_hash
+	{
+		typedef T argument_type;
+		typedef std::size_t result_type;
+
+		std::size_t operator()(T x) const
+		{
+			return ft::hash_mix(static_cast<std::size_t>(x));
+		}
+	};
+
+	template <> struct hash<bool> : ft::integral_hash<bool> {};
+	template <> struct hash<char> : ft::integral_hash<char> {};
+	template <> struct hash<signed char> : ft::integral_hash<signed char> {};
+	template <> struct hash<unsigned char> : ft::integral_hash<unsigned char> {};
+	template <> struct hash<wchar_t> : ft::integral_hash<wchar_t> {};
+	template <> struct hash<short> : ft::integral_hash<short> {};
+	template <> struct hash<unsigned short> : ft::integral_hash<unsigned short> {};
+	template <> struct hash<int> : ft::integral_hash<int> {};
+	template <> struct hash<unsigned int> : ft::integral_hash<unsigned int> {};
+	template <> struct hash<long> : ft::integral_hash<long> {};
+	template <> struct hash<unsigned long> : ft::integral_hash<unsigned long> {};
+
+	template <class T>
+	struct hash<T*>
+	{
+		typedef T* argument_type;
+		typedef std::size_t result_type;
+
+		std::size_t operator()(T* p) const
+		{
+			return ft::hash_mix(reinterpret_cast<std::size_t>(p));
+		}
+	};
+
+	template <>
+	struct hash<std::string>
+	{
+		typedef std::string argument_type;
+		typedef std::size_t result_type;
+
+		// FNV-1a
+		std::size_t operator()(std::string const& str) const
+		{
+			std::size_t h = 2166136261UL;
+			for (std::string::size_type i = 0, size = str.size(); i < size;
+					++i) {
+				h ^= static_cast<unsigned char>(str[i]);
+				h *= 16777619UL;
+			}
+			return h;
+		}
+	};
+}
+
+#endif
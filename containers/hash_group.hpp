@@ -0,0 +1,165 @@
+#ifndef HASH_GROUP_HPP
+#define HASH_GROUP_HPP
+
+#include <cstring>
+#include <stdint.h>
+
+#if defined(__SSE2__)
+# include <emmintrin.h>
+#endif
+
+namespace ft
+{
+	typedef signed char hash_ctrl;
+
+	// Control byte values, full slots hold the 7 low bits of their hash.
+	enum
+	{
+		hash_ctrl_empty = -128,
+		hash_ctrl_deleted = -2,
+		hash_ctrl_sentinel = -1
+	};
+
+	// Positions of a group matching a predicate, one bit per position, or
+	// the high bit of each byte when Shift is 3.
+	template <class Mask, int Shift>
+	class hash_group_mask
+	{
+	public:
+		explicit hash_group_mask(Mask mask) :
+			mask_(mask)
+		{
+			return;
+		}
+
+		bool any() const
+		{
+			return this->mask_ != 0;
+		}
+
+		int lowest() const
+		{
+			return count_trailing_zeros(this->mask_) >> Shift;
+		}
+
+		void clear_lowest()
+		{
+			this->mask_ &= this->mask_ - 1;
+			return;
+		}
+
+		// Positions after the last match, the mask must not be empty.
+		int leading_zeros() const
+		{
+			return (count_leading_zeros(this->mask_)
+					- (sizeof(unsigned long long) * 8 - sizeof(Mask) * 8))
+				>> Shift;
+		}
+
+	private:
+		Mask mask_;
+
+		static int count_trailing_zeros(Mask mask)
+		{
+			return __builtin_ctzll(mask);
+		}
+
+		static int count_leading_zeros(Mask mask)
+		{
+			return __builtin_clzll(mask);
+		}
+	};
+
+	// Eight control bytes compared at once in a 64 bits word. match() may
+	// report a false positive next to a true match, keys are compared
+	// anyway.
+	class portable_hash_group
+	{
+	public:
+		enum { width = 8 };
+		typedef hash_group_mask<uint64_t, 3> mask_type;
+
+		// Byte i of the group is byte i of the word, whatever the endianness.
+		explicit portable_hash_group(hash_ctrl const* ctrl) :
+			ctrl_(0)
+		{
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+			std::memcpy(&this->ctrl_, ctrl, sizeof(this->ctrl_));
+#else
+			for (int i = 0; i < width; ++i) {
+				this->ctrl_ |= static_cast<uint64_t>(
+						static_cast<unsigned char>(ctrl[i])) << (i * 8);
+			}
+#endif
+			return;
+		}
+
+		mask_type match(hash_ctrl tag) const
+		{
+			uint64_t x = this->ctrl_ ^ (lsbs * static_cast<unsigned char>(tag));
+			return mask_type((x - lsbs) & ~x & msbs);
+		}
+
+		mask_type match_empty() const
+		{
+			return mask_type(this->ctrl_ & ~(this->ctrl_ << 6) & msbs);
+		}
+
+		// empty or deleted
+		mask_type match_free() const
+		{
+			return mask_type(this->ctrl_ & ~(this->ctrl_ << 7) & msbs);
+		}
+
+	private:
+		static uint64_t const lsbs = 0x0101010101010101ULL;
+		static uint64_t const msbs = 0x8080808080808080ULL;
+
+		uint64_t ctrl_;
+	};
+
+#if defined(__SSE2__)
+	class sse2_hash_group
+	{
+	public:
+		enum { width = 16 };
+		typedef hash_group_mask<unsigned short, 0> mask_type;
+
+		explicit sse2_hash_group(hash_ctrl const* ctrl) :
+			ctrl_(_mm_loadu_si128(reinterpret_cast<__m128i const*>(ctrl)))
+		{
+			return;
+		}
+
+		mask_type match(hash_ctrl tag) const
+		{
+			return mask_type(static_cast<unsigned short>(_mm_movemask_epi8(
+							_mm_cmpeq_epi8(_mm_set1_epi8(tag), this->ctrl_))));
+		}
+
+		mask_type match_empty() const
+		{
+			return this->match(hash_ctrl_empty);
+		}
+
+		mask_type match_free() const
+		{
+			return mask_type(static_cast<unsigned short>(_mm_movemask_epi8(
+							_mm_cmpgt_epi8(_mm_set1_epi8(hash_ctrl_sentinel),
+								this->ctrl_))));
+		}
+
+	private:
+		__m128i ctrl_;
+	};
+#endif
+
+	// FT_PORTABLE_HASH_GROUP forces the scalar groups on SSE2 targets.
+#if defined(__SSE2__) && !defined(FT_PORTABLE_HASH_GROUP)
+	typedef sse2_hash_group hash_group;
+#else
+	typedef portable_hash_group hash_group;
+#endif
+}
+
+#endif
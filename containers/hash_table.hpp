@@ -0,0 +1,831 @@
+#ifndef HASH_TABLE_HPP
+#define HASH_TABLE_HPP
+
+#include <iterator>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <utility>
+
+#include "iterator_traits.hpp"
+#include "pair.hpp"
+#include "hash_group.hpp"
+
+namespace ft
+{
+	// Open addressing unique-key storage shared by unordered_map and
+	// unordered_set, laid out like a Swiss table. Every slot has a control
+	// byte telling whether it is empty, erased or full, a full one keeping 7
+	// bits of the key hash. Probes load a whole group of control bytes and
+	// compare them at once (see hash_group.hpp), so a missing key is usually
+	// rejected after a single group without reading any slot.
+	//
+	// There are 2^k - 1 slots, their control bytes are followed by a
+	// sentinel ending iterations then by a copy of the first group_width - 1
+	// ones, letting a group start at any slot. Groups are probed
+	// quadratically. Iterators are invalidated by rehashes only.
+	template <class Key, class Value, class KeyOfValue, class Hash,
+			 class KeyEqual, class Alloc>
+	class hash_table
+	{
+	public:
+		typedef Key key_type;
+		typedef Value value_type;
+		typedef Hash hasher;
+		typedef KeyEqual key_equal;
+		typedef Alloc allocator_type;
+		typedef typename allocator_type::reference reference;
+		typedef typename allocator_type::const_reference const_reference;
+		typedef typename allocator_type::pointer pointer;
+		typedef typename allocator_type::const_pointer const_pointer;
+		typedef std::ptrdiff_t difference_type;
+		typedef std::size_t size_type;
+		typedef ft::hash_ctrl ctrl_type;
+		class iterator;
+		class const_iterator;
+
+		enum
+		{
+			ctrl_empty = ft::hash_ctrl_empty,
+			ctrl_deleted = ft::hash_ctrl_deleted,
+			ctrl_sentinel = ft::hash_ctrl_sentinel
+		};
+
+	protected:
+		typedef typename allocator_type::template rebind<ctrl_type>::other
+			ctrl_allocator_type;
+		typedef ft::hash_group group_type;
+		typedef group_type::mask_type group_mask_type;
+
+		enum { group_width = group_type::width };
+		enum { min_capacity = group_width - 1 };
+
+	public:
+		class iterator
+		{
+		public:
+			typedef typename hash_table::value_type value_type;
+			typedef typename hash_table::difference_type difference_type;
+			typedef typename hash_table::pointer pointer;
+			typedef typename hash_table::reference reference;
+			typedef std::forward_iterator_tag iterator_category;
+
+			ctrl_type const* ctrl_;
+			pointer slot_;
+
+			iterator() :
+				ctrl_(NULL),
+				slot_(NULL)
+			{
+				return;
+			}
+
+			iterator(ctrl_type const* ctrl, pointer slot) :
+				ctrl_(ctrl),
+				slot_(slot)
+			{
+				return;
+			}
+
+			iterator(iterator const& src) :
+				ctrl_(src.ctrl_),
+				slot_(src.slot_)
+			{
+				return;
+			}
+
+			virtual ~iterator()
+			{
+				return;
+			}
+
+			iterator& operator=(iterator const& rhs)
+			{
+				this->ctrl_ = rhs.ctrl_;
+				this->slot_ = rhs.slot_;
+				return *this;
+			}
+
+			bool operator==(const_iterator const& rhs) const
+			{
+				return this->ctrl_ == rhs.ctrl_;
+			}
+
+			bool operator!=(const_iterator const& rhs) const
+			{
+				return this->ctrl_ != rhs.ctrl_;
+			}
+
+			reference operator*() const
+			{
+				return *this->slot_;
+			}
+
+			pointer operator->() const
+			{
+				return this->slot_;
+			}
+
+			iterator& operator++()
+			{
+				++this->ctrl_;
+				++this->slot_;
+				this->skip_free_slots();
+				return *this;
+			}
+
+			iterator operator++(int)
+			{
+				iterator tmp = *this;
+				++(*this);
+				return tmp;
+			}
+
+			// The sentinel after the last slot stops the scan.
+			void skip_free_slots()
+			{
+				while (*this->ctrl_ < ctrl_sentinel) {
+					++this->ctrl_;
+					++this->slot_;
+				}
+				return;
+			}
+		};
+
+		class const_iterator
+		{
+		public:
+			typedef typename hash_table::value_type value_type;
+			typedef typename hash_table::difference_type difference_type;
+			typedef typename hash_table::const_pointer pointer;
+			typedef typename hash_table::const_reference reference;
+			typedef std::forward_iterator_tag iterator_category;
+
+			ctrl_type const* ctrl_;
+			pointer slot_;
+
+			const_iterator() :
+				ctrl_(NULL),
+				slot_(NULL)
+			{
+				return;
+			}
+
+			const_iterator(ctrl_type const* ctrl, pointer slot) :
+				ctrl_(ctrl),
+				slot_(slot)
+			{
+				return;
+			}
+
+			const_iterator(iterator const& src) :
+				ctrl_(src.ctrl_),
+				slot_(src.slot_)
+			{
+				return;
+			}
+
+			const_iterator(const_iterator const& src) :
+				ctrl_(src.ctrl_),
+				slot_(src.slot_)
+			{
+				return;
+			}
+
+			virtual ~const_iterator()
+			{
+				return;
+			}
+
+			const_iterator& operator=(const_iterator const& rhs)
+			{
+				this->ctrl_ = rhs.ctrl_;
+				this->slot_ = rhs.slot_;
+				return *this;
+			}
+
+			bool operator==(const_iterator const& rhs) const
+			{
+				return this->ctrl_ == rhs.ctrl_;
+			}
+
+			bool operator!=(const_iterator const& rhs) const
+			{
+				return this->ctrl_ != rhs.ctrl_;
+			}
+
+			reference operator*() const
+			{
+				return *this->slot_;
+			}
+
+			pointer operator->() const
+			{
+				return this->slot_;
+			}
+
+			const_iterator& operator++()
+			{
+				++this->ctrl_;
+				++this->slot_;
+				this->skip_free_slots();
+				return *this;
+			}
+
+			const_iterator operator++(int)
+			{
+				const_iterator tmp = *this;
+				++(*this);
+				return tmp;
+			}
+
+			void skip_free_slots()
+			{
+				while (*this->ctrl_ < ctrl_sentinel) {
+					++this->ctrl_;
+					++this->slot_;
+				}
+				return;
+			}
+		};
+
+	protected:
+		hasher hash_;
+		key_equal equal_;
+		allocator_type alloc_;
+		ctrl_allocator_type ctrl_alloc_;
+		ctrl_type* ctrl_;
+		pointer slots_;
+		size_type capacity_;
+		size_type size_;
+		size_type deleted_;
+		size_type growth_limit_;
+		float max_load_factor_;
+
+	public:
+		explicit hash_table(hasher const& hash = hasher(),
+				key_equal const& equal = key_equal(),
+				allocator_type const& alloc = allocator_type()) :
+			hash_(hash),
+			equal_(equal),
+			alloc_(alloc),
+			ctrl_alloc_(),
+			ctrl_(empty_ctrl()),
+			slots_(NULL),
+			capacity_(0),
+			size_(0),
+			deleted_(0),
+			growth_limit_(0),
+			max_load_factor_(0.875f)
+		{
+			return;
+		}
+
+		hash_table(hash_table const& x) :
+			hash_(x.hash_),
+			equal_(x.equal_),
+			alloc_(x.alloc_),
+			ctrl_alloc_(x.ctrl_alloc_),
+			ctrl_(empty_ctrl()),
+			slots_(NULL),
+			capacity_(0),
+			size_(0),
+			deleted_(0),
+			growth_limit_(0),
+			max_load_factor_(x.max_load_factor_)
+		{
+			try {
+				this->reserve(x.size_);
+				for (const_iterator cit = x.begin(), cite = x.end();
+						cit != cite; ++cit) {
+					this->insert_distinct(*cit);
+				}
+			}
+			catch (...) {
+				this->destroy_values();
+				this->deallocate_arrays();
+				throw;
+			}
+			return;
+		}
+
+		~hash_table()
+		{
+			this->destroy_values();
+			this->deallocate_arrays();
+			return;
+		}
+
+		hash_table& operator=(hash_table const& x)
+		{
+			if (this != &x) {
+				hash_table tmp(x);
+				this->swap(tmp);
+			}
+			return *this;
+		}
+
+#if __cplusplus >= 201103L
+		hash_table(hash_table&& x) :
+			hash_table(x.hash_, x.equal_, x.alloc_)
+		{
+			this->swap(x);
+			return;
+		}
+
+		hash_table& operator=(hash_table&& x)
+		{
+			if (this != &x) {
+				hash_table tmp(std::move(x));
+				this->swap(tmp);
+			}
+			return *this;
+		}
+#endif
+
+		iterator begin()
+		{
+			iterator it(this->ctrl_, this->slots_);
+			it.skip_free_slots();
+			return it;
+		}
+
+		const_iterator begin() const
+		{
+			const_iterator it(this->ctrl_, this->slots_);
+			it.skip_free_slots();
+			return it;
+		}
+
+		iterator end()
+		{
+			return iterator(this->ctrl_ + this->capacity_,
+					this->slots_ + this->capacity_);
+		}
+
+		const_iterator end() const
+		{
+			return const_iterator(this->ctrl_ + this->capacity_,
+					this->slots_ + this->capacity_);
+		}
+
+		bool empty() const
+		{
+			return this->size_ == 0;
+		}
+
+		size_type size() const
+		{
+			return this->size_;
+		}
+
+		size_type max_size() const
+		{
+			return this->alloc_.max_size();
+		}
+
+		ft::pair<iterator,bool> insert_unique(value_type const& val)
+		{
+			key_type const& key = KeyOfValue()(val);
+			size_type hash = this->hash_(key);
+			if (this->capacity_ == 0) {
+				this->grow();
+			}
+			size_type index = this->find_index(key, hash);
+			if (index != this->capacity_) {
+				return ft::pair<iterator,bool>(this->iterator_at(index), false);
+			}
+			index = this->find_free(hash);
+			if (this->ctrl_[index] == ctrl_empty
+					&& this->size_ + this->deleted_ >= this->growth_limit_) {
+				this->grow();
+				index = this->find_free(hash);
+			}
+			this->construct_at(index, hash, val);
+			return ft::pair<iterator,bool>(this->iterator_at(index), true);
+		}
+
+		template <class InputIterator>
+		void insert_unique(InputIterator first, InputIterator last)
+		{
+			while (first != last) {
+				this->insert_unique(*first);
+				++first;
+			}
+			return;
+		}
+
+		void erase(const_iterator position)
+		{
+			this->erase_at(position.ctrl_ - this->ctrl_);
+			return;
+		}
+
+		size_type erase_unique(key_type const& k)
+		{
+			size_type index = this->find_index(k);
+			if (index == this->capacity_) {
+				return 0;
+			}
+			this->erase_at(index);
+			return 1;
+		}
+
+		void erase(const_iterator first, const_iterator last)
+		{
+			while (first != last) {
+				const_iterator next = first;
+				++next;
+				this->erase(first);
+				first = next;
+			}
+			return;
+		}
+
+		void swap(hash_table& x)
+		{
+			hash_table_swap(this->hash_, x.hash_);
+			hash_table_swap(this->equal_, x.equal_);
+			hash_table_swap(this->ctrl_, x.ctrl_);
+			hash_table_swap(this->slots_, x.slots_);
+			hash_table_swap(this->capacity_, x.capacity_);
+			hash_table_swap(this->size_, x.size_);
+			hash_table_swap(this->deleted_, x.deleted_);
+			hash_table_swap(this->growth_limit_, x.growth_limit_);
+			hash_table_swap(this->max_load_factor_, x.max_load_factor_);
+			return;
+		}
+
+		// Keeps the slots, like std::unordered_map keeps its buckets.
+		void clear()
+		{
+			this->destroy_values();
+			if (this->capacity_ != 0) {
+				reset_ctrl(this->ctrl_, this->capacity_);
+			}
+			this->size_ = 0;
+			this->deleted_ = 0;
+			return;
+		}
+
+		hasher hash_function() const
+		{
+			return this->hash_;
+		}
+
+		key_equal key_eq() const
+		{
+			return this->equal_;
+		}
+
+		iterator find(key_type const& k)
+		{
+			return this->iterator_at(this->find_index(k));
+		}
+
+		const_iterator find(key_type const& k) const
+		{
+			size_type index = this->find_index(k);
+			return const_iterator(this->ctrl_ + index, this->slots_ + index);
+		}
+
+		size_type count(key_type const& k) const
+		{
+			return this->find_index(k) != this->capacity_;
+		}
+
+		ft::pair<iterator,iterator> equal_range(key_type const& k)
+		{
+			iterator first = this->find(k);
+			iterator last = first;
+			if (first != this->end()) {
+				++last;
+			}
+			return ft::pair<iterator,iterator>(first, last);
+		}
+
+		ft::pair<const_iterator,const_iterator> equal_range(
+				key_type const& k) const
+		{
+			const_iterator first = this->find(k);
+			const_iterator last = first;
+			if (first != this->end()) {
+				++last;
+			}
+			return ft::pair<const_iterator,const_iterator>(first, last);
+		}
+
+		size_type bucket_count() const
+		{
+			return this->capacity_;
+		}
+
+		float load_factor() const
+		{
+			if (this->capacity_ == 0) {
+				return 0.0f;
+			}
+			return static_cast<float>(this->size_) / this->capacity_;
+		}
+
+		float max_load_factor() const
+		{
+			return this->max_load_factor_;
+		}
+
+		// Probes end on empty slots, the factor is kept at most 0.95.
+		void max_load_factor(float ml)
+		{
+			if (!(ml > 0.0f)) {
+				return;
+			}
+			if (ml > 0.95f) {
+				ml = 0.95f;
+			}
+			this->max_load_factor_ = ml;
+			if (this->capacity_ != 0) {
+				this->growth_limit_ = this->growth_limit_for(this->capacity_);
+				if (this->size_ + this->deleted_ > this->growth_limit_) {
+					this->rehash_to(this->capacity_for(this->size_));
+				}
+			}
+			return;
+		}
+
+		void rehash(size_type n)
+		{
+			size_type capacity = this->capacity_for(this->size_);
+			while (capacity < n) {
+				capacity = capacity * 2 + 1;
+			}
+			if (this->size_ == 0 && n == 0) {
+				this->destroy_values();
+				this->deallocate_arrays();
+				this->reset();
+				return;
+			}
+			this->rehash_to(capacity);
+			return;
+		}
+
+		void reserve(size_type n)
+		{
+			if (n > this->growth_limit_ || this->capacity_ == 0) {
+				if (n == 0) {
+					return;
+				}
+				this->rehash_to(this->capacity_for(n));
+			}
+			return;
+		}
+
+		allocator_type get_allocator() const
+		{
+			return this->alloc_;
+		}
+
+	private:
+		template <class T>
+		static void hash_table_swap(T& lhs, T& rhs)
+		{
+			T tmp = lhs;
+			lhs = rhs;
+			rhs = tmp;
+			return;
+		}
+
+		// Control bytes of a table without slots, begin() and end() both
+		// stop on its sentinel.
+		static ctrl_type* empty_ctrl()
+		{
+			static ctrl_type ctrl[1] = { ctrl_sentinel };
+			return ctrl;
+		}
+
+		static ctrl_type hash_tag(size_type hash)
+		{
+			return static_cast<ctrl_type>(hash & 0x7f);
+		}
+
+		static void reset_ctrl(ctrl_type* ctrl, size_type capacity)
+		{
+			std::memset(ctrl, ctrl_empty, capacity + group_width);
+			ctrl[capacity] = ctrl_sentinel;
+			return;
+		}
+
+		// Writes the control byte of a slot and its copy after the sentinel.
+		void set_ctrl(size_type index, ctrl_type value)
+		{
+			this->ctrl_[index] = value;
+			if (index < group_width - 1) {
+				this->ctrl_[this->capacity_ + 1 + index] = value;
+			}
+			return;
+		}
+
+		size_type probe_start(size_type hash) const
+		{
+			return (hash >> 7) & this->capacity_;
+		}
+
+		iterator iterator_at(size_type index)
+		{
+			return iterator(this->ctrl_ + index, this->slots_ + index);
+		}
+
+		size_type find_index(key_type const& k) const
+		{
+			if (this->size_ == 0) {
+				return this->capacity_;
+			}
+			return this->find_index(k, this->hash_(k));
+		}
+
+		// Index of the key, capacity_ when it is not in the table.
+		size_type find_index(key_type const& k, size_type hash) const
+		{
+			ctrl_type tag = hash_tag(hash);
+			size_type position = this->probe_start(hash);
+			size_type step = 0;
+			while (true) {
+				group_type group(this->ctrl_ + position);
+				for (group_mask_type match = group.match(tag); match.any() == true;
+						match.clear_lowest()) {
+					size_type i = (position + match.lowest()) & this->capacity_;
+					if (this->equal_(KeyOfValue()(this->slots_[i]), k) == true) {
+						return i;
+					}
+				}
+				if (group.match_empty().any() == true) {
+					return this->capacity_;
+				}
+				step += group_width;
+				position = (position + step) & this->capacity_;
+			}
+		}
+
+		// First empty or deleted slot of the probe sequence.
+		size_type find_free(size_type hash) const
+		{
+			size_type position = this->probe_start(hash);
+			size_type step = 0;
+			while (true) {
+				group_mask_type free = group_type(this->ctrl_ + position)
+					.match_free();
+				if (free.any() == true) {
+					return (position + free.lowest()) & this->capacity_;
+				}
+				step += group_width;
+				position = (position + step) & this->capacity_;
+			}
+		}
+
+		void construct_at(size_type index, size_type hash,
+				value_type const& val)
+		{
+			this->alloc_.construct(this->slots_ + index, val);
+			if (this->ctrl_[index] == ctrl_deleted) {
+				this->deleted_--;
+			}
+			this->set_ctrl(index, hash_tag(hash));
+			this->size_++;
+			return;
+		}
+
+		// For values known to be absent, with room left for them.
+		void insert_distinct(value_type const& val)
+		{
+			size_type hash = this->hash_(KeyOfValue()(val));
+			this->construct_at(this->find_free(hash), hash, val);
+			return;
+		}
+
+		// A probe only goes past a slot when the whole group it loaded was
+		// full. If every window of group_width bytes holding the slot has an
+		// empty byte, no probe ever did and the slot can be emptied instead
+		// of becoming a tombstone.
+		void erase_at(size_type index)
+		{
+			this->alloc_.destroy(this->slots_ + index);
+			group_mask_type empty_after = group_type(this->ctrl_ + index)
+				.match_empty();
+			group_mask_type empty_before = group_type(this->ctrl_
+					+ ((index - group_width) & this->capacity_)).match_empty();
+			if (empty_before.any() == true && empty_after.any() == true
+					&& empty_after.lowest() + empty_before.leading_zeros()
+					< group_width) {
+				this->set_ctrl(index, ctrl_empty);
+			}
+			else {
+				this->set_ctrl(index, ctrl_deleted);
+				this->deleted_++;
+			}
+			this->size_--;
+			return;
+		}
+
+		size_type growth_limit_for(size_type capacity) const
+		{
+			size_type limit = static_cast<size_type>(capacity
+					* this->max_load_factor_);
+			if (limit >= capacity) {
+				limit = capacity - 1;
+			}
+			return limit;
+		}
+
+		size_type capacity_for(size_type n) const
+		{
+			size_type capacity = min_capacity;
+			while (this->growth_limit_for(capacity) < n) {
+				capacity = capacity * 2 + 1;
+			}
+			return capacity;
+		}
+
+		// Tombstones filling a quarter of the limit are cleaned in place,
+		// which pays for itself over the inserts it makes room for, as long
+		// as the values alone stay under the limit. Otherwise the capacity
+		// is doubled until they do, so an empty slot is always left.
+		void grow()
+		{
+			if (this->capacity_ == 0) {
+				this->rehash_to(this->capacity_for(1));
+			}
+			else if (this->deleted_ != 0
+					&& this->deleted_ >= this->growth_limit_ / 4
+					&& this->size_ < this->growth_limit_) {
+				this->rehash_to(this->capacity_);
+			}
+			else {
+				size_type capacity = this->capacity_ * 2 + 1;
+				while (this->growth_limit_for(capacity) <= this->size_) {
+					capacity = capacity * 2 + 1;
+				}
+				this->rehash_to(capacity);
+			}
+			return;
+		}
+
+		void rehash_to(size_type capacity)
+		{
+			ctrl_type* new_ctrl = this->ctrl_alloc_.allocate(capacity
+					+ group_width);
+			pointer new_slots;
+			try {
+				new_slots = this->alloc_.allocate(capacity);
+			}
+			catch (...) {
+				this->ctrl_alloc_.deallocate(new_ctrl, capacity + group_width);
+				throw;
+			}
+			reset_ctrl(new_ctrl, capacity);
+			hash_table tmp(this->hash_, this->equal_, this->alloc_);
+			tmp.ctrl_ = new_ctrl;
+			tmp.slots_ = new_slots;
+			tmp.capacity_ = capacity;
+			tmp.growth_limit_ = this->growth_limit_for(capacity);
+			tmp.max_load_factor_ = this->max_load_factor_;
+			for (const_iterator cit = this->begin(), cite = this->end();
+					cit != cite; ++cit) {
+				tmp.insert_distinct(*cit);
+			}
+			this->swap(tmp);
+			return;
+		}
+
+		void destroy_values()
+		{
+			for (size_type i = 0; i < this->capacity_; ++i) {
+				if (this->ctrl_[i] >= 0) {
+					this->alloc_.destroy(this->slots_ + i);
+				}
+			}
+			return;
+		}
+
+		void deallocate_arrays()
+		{
+			if (this->capacity_ != 0) {
+				this->ctrl_alloc_.deallocate(this->ctrl_,
+						this->capacity_ + group_width);
+				this->alloc_.deallocate(this->slots_, this->capacity_);
+			}
+			return;
+		}
+
+		void reset()
+		{
+			this->ctrl_ = empty_ctrl();
+			this->slots_ = NULL;
+			this->capacity_ = 0;
+			this->size_ = 0;
+			this->deleted_ = 0;
+			this->growth_limit_ = 0;
+			return;
+		}
+	};
+}
+
+#endif
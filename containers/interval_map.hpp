@@ -0,0 +1,686 @@
+#ifndef INTERVAL_MAP_HPP
+#define INTERVAL_MAP_HPP
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+#include "comparaison.hpp"
+#include "less.hpp"
+#include "pair.hpp"
+#include "reverse_iterator.hpp"
+#include "rb_tree.hpp"
+
+namespace ft
+{
+	// Orders the intervals by low bound, then by high bound.
+	template <class Key, class Compare>
+	struct interval_less
+	{
+		typedef ft::pair<Key, Key> interval_type;
+
+		Compare comp;
+
+		interval_less(Compare const& c = Compare()) :
+			comp(c)
+		{
+			return;
+		}
+
+		bool operator()(interval_type const& x, interval_type const& y) const
+		{
+			if (this->comp(x.first, y.first) == true) {
+				return true;
+			}
+			if (this->comp(y.first, x.first) == true) {
+				return false;
+			}
+			return this->comp(x.second, y.second);
+		}
+	};
+
+	// Tree element of an interval_map, the greatest high bound of its
+	// subtree beside the value.
+	template <class Value, class Key>
+	struct interval_map_entry
+	{
+		Value val;
+		Key max_high;
+
+		interval_map_entry() :
+			val(),
+			max_high()
+		{
+			return;
+		}
+
+		interval_map_entry(Value const& v) :
+			val(v),
+			max_high(v.first.second)
+		{
+			return;
+		}
+	};
+
+	// Associative container of values keyed by half-open intervals
+	// [low, high), allowing equal intervals. Each red-black node keeps the
+	// greatest high bound of its subtree so the subtrees without overlapping
+	// intervals are skipped by the queries. Compare is default constructed
+	// to maintain these bounds.
+	template < class Key, class T, class Compare = ft::less<Key>,
+			 class Alloc = std::allocator<
+				 ft::pair<ft::pair<Key, Key> const, T> > >
+	class interval_map
+	{
+	public:
+		typedef Key point_type;
+		typedef ft::pair<Key, Key> key_type;
+		typedef T mapped_type;
+		typedef ft::pair<key_type const, mapped_type> value_type;
+		typedef Compare point_compare;
+		typedef ft::interval_less<Key, Compare> key_compare;
+		typedef Alloc allocator_type;
+		typedef typename allocator_type::reference reference;
+		typedef typename allocator_type::const_reference const_reference;
+		typedef typename allocator_type::pointer pointer;
+		typedef typename allocator_type::const_pointer const_pointer;
+		typedef std::ptrdiff_t difference_type;
+		typedef std::size_t size_type;
+
+	protected:
+		typedef ft::interval_map_entry<value_type, Key> entry_type;
+
+		struct select_interval
+		{
+			key_type const& operator()(entry_type const& x) const
+			{
+				return x.val.first;
+			}
+		};
+
+		struct update_max_high
+		{
+			enum { enabled = 1 };
+
+			void operator()(entry_type& x, entry_type const* left,
+					entry_type const* right) const
+			{
+				Compare comp;
+				x.max_high = x.val.first.second;
+				if (left != NULL && comp(x.max_high, left->max_high) == true) {
+					x.max_high = left->max_high;
+				}
+				if (right != NULL && comp(x.max_high, right->max_high) == true) {
+					x.max_high = right->max_high;
+				}
+				return;
+			}
+		};
+
+		typedef typename allocator_type::template rebind<entry_type>::other
+			entry_allocator_type;
+		typedef ft::rb_tree<key_type, entry_type, select_interval, key_compare,
+				entry_allocator_type, update_max_high> base_tree_type;
+
+		class tree_type : public base_tree_type
+		{
+		public:
+			typedef typename base_tree_type::rbt_node rbt_node;
+
+			tree_type(key_compare const& comp,
+					entry_allocator_type const& alloc) :
+				base_tree_type(comp, alloc)
+			{
+				return;
+			}
+
+			tree_type(tree_type const& x) :
+				base_tree_type(x)
+			{
+				return;
+			}
+
+#if __cplusplus >= 201103L
+			tree_type(tree_type&& x) = default;
+			tree_type& operator=(tree_type const& x) = default;
+			tree_type& operator=(tree_type&& x) = default;
+#endif
+
+			// The first node, in order, overlapping [low, high). A left
+			// subtree holding a high bound above low holds an overlapping
+			// interval unless no node after it does, so one path is walked.
+			rbt_node* find_overlap(Key const& low, Key const& high) const
+			{
+				rbt_node* node = this->root_node_;
+				while (this->is_leaf(node) == false) {
+					if (this->is_leaf(node->left) == false
+							&& this->comp_.comp(low,
+								node->left->val.max_high) == true) {
+						node = node->left;
+					}
+					else if (this->comp_.comp(node->val.val.first.first,
+								high) == false) {
+						return this->ghost_node_;
+					}
+					else if (this->comp_.comp(low,
+								node->val.val.first.second) == true) {
+						return node;
+					}
+					else {
+						node = node->right;
+					}
+				}
+				return this->ghost_node_;
+			}
+
+			// Calls fn, in order, on the intervals whose high bound is above
+			// low and whose low bound is below high, or not above it when
+			// closed is true. The subtrees whose greatest high bound is not
+			// above low are skipped.
+			template <class Function, class Reference>
+			Function for_each_overlap(Key const& low, Key const& high,
+					bool closed, Function fn) const
+			{
+				rbt_node* stack[base_tree_type::max_height];
+				int depth = 0;
+				rbt_node* node = this->root_node_;
+				while (1) {
+					while (this->is_leaf(node) == false
+							&& this->comp_.comp(low, node->val.max_high) == true) {
+						stack[depth++] = node;
+						node = node->left;
+					}
+					if (depth == 0) {
+						break;
+					}
+					node = stack[--depth];
+					Key const& node_low = node->val.val.first.first;
+					if ((closed == true && this->comp_.comp(high, node_low) == true)
+							|| (closed == false
+								&& this->comp_.comp(node_low, high) == false)) {
+						break;
+					}
+					if (this->comp_.comp(low, node->val.val.first.second) == true) {
+						Reference val = node->val.val;
+						fn(val);
+					}
+					node = node->right;
+				}
+				return fn;
+			}
+		};
+
+	public:
+		class const_iterator;
+
+		class iterator
+		{
+		public:
+			typedef typename interval_map::value_type value_type;
+			typedef typename interval_map::difference_type difference_type;
+			typedef typename interval_map::pointer pointer;
+			typedef typename interval_map::reference reference;
+			typedef std::bidirectional_iterator_tag iterator_category;
+
+			typename tree_type::iterator tree_it_;
+
+			iterator() :
+				tree_it_()
+			{
+				return;
+			}
+
+			iterator(typename tree_type::iterator tree_it) :
+				tree_it_(tree_it)
+			{
+				return;
+			}
+
+			bool operator==(const_iterator const& rhs) const
+			{
+				return this->tree_it_ == rhs.tree_it_;
+			}
+
+			bool operator!=(const_iterator const& rhs) const
+			{
+				return this->tree_it_ != rhs.tree_it_;
+			}
+
+			reference operator*() const
+			{
+				return this->tree_it_->val;
+			}
+
+			pointer operator->() const
+			{
+				return &this->tree_it_->val;
+			}
+
+			iterator& operator++()
+			{
+				++this->tree_it_;
+				return *this;
+			}
+
+			iterator operator++(int)
+			{
+				iterator tmp(*this);
+				++this->tree_it_;
+				return tmp;
+			}
+
+			iterator& operator--()
+			{
+				--this->tree_it_;
+				return *this;
+			}
+
+			iterator operator--(int)
+			{
+				iterator tmp(*this);
+				--this->tree_it_;
+				return tmp;
+			}
+		};
+
+		class const_iterator
+		{
+		public:
+			typedef typename interval_map::value_type value_type;
+			typedef typename interval_map::difference_type difference_type;
+			typedef typename interval_map::const_pointer pointer;
+			typedef typename interval_map::const_reference reference;
+			typedef std::bidirectional_iterator_tag iterator_category;
+
+			typename tree_type::const_iterator tree_it_;
+
+			const_iterator() :
+				tree_it_()
+			{
+				return;
+			}
+
+			const_iterator(typename tree_type::const_iterator tree_it) :
+				tree_it_(tree_it)
+			{
+				return;
+			}
+
+			const_iterator(iterator const& src) :
+				tree_it_(src.tree_it_)
+			{
+				return;
+			}
+
+			bool operator==(const_iterator const& rhs) const
+			{
+				return this->tree_it_ == rhs.tree_it_;
+			}
+
+			bool operator!=(const_iterator const& rhs) const
+			{
+				return this->tree_it_ != rhs.tree_it_;
+			}
+
+			reference operator*() const
+			{
+				return this->tree_it_->val;
+			}
+
+			pointer operator->() const
+			{
+				return &this->tree_it_->val;
+			}
+
+			const_iterator& operator++()
+			{
+				++this->tree_it_;
+				return *this;
+			}
+
+			const_iterator operator++(int)
+			{
+				const_iterator tmp(*this);
+				++this->tree_it_;
+				return tmp;
+			}
+
+			const_iterator& operator--()
+			{
+				--this->tree_it_;
+				return *this;
+			}
+
+			const_iterator operator--(int)
+			{
+				const_iterator tmp(*this);
+				--this->tree_it_;
+				return tmp;
+			}
+		};
+
+		typedef ft::reverse_iterator<iterator> reverse_iterator;
+		typedef ft::reverse_iterator<const_iterator> const_reverse_iterator;
+
+	protected:
+		tree_type tree_;
+
+	public:
+		explicit interval_map(point_compare const& comp = point_compare(),
+				allocator_type const& alloc = allocator_type()) :
+			tree_(key_compare(comp), entry_allocator_type(alloc))
+		{
+			return;
+		}
+
+		template <class InputIterator>
+		interval_map(InputIterator first, InputIterator last,
+				point_compare const& comp = point_compare(),
+				allocator_type const& alloc = allocator_type()) :
+			tree_(key_compare(comp), entry_allocator_type(alloc))
+		{
+			this->insert(first, last);
+			return;
+		}
+
+		interval_map(interval_map const& x) :
+			tree_(x.tree_)
+		{
+			return;
+		}
+
+		~interval_map()
+		{
+			return;
+		}
+
+		interval_map& operator=(interval_map const& x)
+		{
+			this->tree_ = x.tree_;
+			return *this;
+		}
+
+#if __cplusplus >= 201103L
+		interval_map(interval_map&& x) :
+			tree_(std::move(x.tree_))
+		{
+			return;
+		}
+
+		interval_map& operator=(interval_map&& x)
+		{
+			this->tree_ = std::move(x.tree_);
+			return *this;
+		}
+#endif
+
+		iterator begin()
+		{
+			return iterator(this->tree_.begin());
+		}
+
+		const_iterator begin() const
+		{
+			return const_iterator(this->tree_.begin());
+		}
+
+		iterator end()
+		{
+			return iterator(this->tree_.end());
+		}
+
+		const_iterator end() const
+		{
+			return const_iterator(this->tree_.end());
+		}
+
+		reverse_iterator rbegin()
+		{
+			return reverse_iterator(this->end());
+		}
+
+		const_reverse_iterator rbegin() const
+		{
+			return const_reverse_iterator(this->end());
+		}
+
+		reverse_iterator rend()
+		{
+			return reverse_iterator(this->begin());
+		}
+
+		const_reverse_iterator rend() const
+		{
+			return const_reverse_iterator(this->begin());
+		}
+
+		bool empty() const
+		{
+			return this->tree_.empty();
+		}
+
+		size_type size() const
+		{
+			return this->tree_.size();
+		}
+
+		size_type max_size() const
+		{
+			return this->tree_.max_size();
+		}
+
+		iterator insert(value_type const& val)
+		{
+			return iterator(this->tree_.insert_equal(entry_type(val)));
+		}
+
+		iterator insert(iterator position, value_type const& val)
+		{
+			return iterator(this->tree_.insert_equal(position.tree_it_,
+						entry_type(val)));
+		}
+
+		template <class InputIterator>
+		void insert(InputIterator first, InputIterator last)
+		{
+			while (first != last) {
+				this->tree_.insert_equal(this->tree_.end(), entry_type(*first));
+				++first;
+			}
+			return;
+		}
+
+		void erase(iterator position)
+		{
+			this->tree_.erase(position.tree_it_);
+			return;
+		}
+
+		size_type erase(key_type const& k)
+		{
+			return this->tree_.erase_equal(k);
+		}
+
+		void erase(iterator first, iterator last)
+		{
+			this->tree_.erase(first.tree_it_, last.tree_it_);
+			return;
+		}
+
+		void swap(interval_map& x)
+		{
+			this->tree_.swap(x.tree_);
+			return;
+		}
+
+		void clear()
+		{
+			this->tree_.clear();
+			return;
+		}
+
+		key_compare key_comp() const
+		{
+			return this->tree_.key_comp();
+		}
+
+		point_compare point_comp() const
+		{
+			return this->tree_.key_comp().comp;
+		}
+
+		// The first element of interval k.
+		iterator find(key_type const& k)
+		{
+			iterator it = this->lower_bound(k);
+			if (it == this->end() || this->key_comp()(k, it->first) == true) {
+				return this->end();
+			}
+			return it;
+		}
+
+		const_iterator find(key_type const& k) const
+		{
+			const_iterator it = this->lower_bound(k);
+			if (it == this->end() || this->key_comp()(k, it->first) == true) {
+				return this->end();
+			}
+			return it;
+		}
+
+		size_type count(key_type const& k) const
+		{
+			return this->tree_.count(k);
+		}
+
+		iterator lower_bound(key_type const& k)
+		{
+			return iterator(this->tree_.lower_bound(k));
+		}
+
+		const_iterator lower_bound(key_type const& k) const
+		{
+			return const_iterator(this->tree_.lower_bound(k));
+		}
+
+		iterator upper_bound(key_type const& k)
+		{
+			return iterator(this->tree_.upper_bound(k));
+		}
+
+		const_iterator upper_bound(key_type const& k) const
+		{
+			return const_iterator(this->tree_.upper_bound(k));
+		}
+
+		// The first element whose interval overlaps [low, high), or end(),
+		// in O(log n).
+		iterator find_overlap(point_type const& low, point_type const& high)
+		{
+			return iterator(typename tree_type::iterator(
+						this->tree_.find_overlap(low, high)));
+		}
+
+		const_iterator find_overlap(point_type const& low,
+				point_type const& high) const
+		{
+			return const_iterator(typename tree_type::const_iterator(
+						this->tree_.find_overlap(low, high)));
+		}
+
+		// Calls fn, in order, on the elements whose interval overlaps
+		// [low, high), in O(log n + k) when the k reported intervals are
+		// short compared to the query.
+		template <class Function>
+		Function for_each_overlap(point_type const& low, point_type const& high,
+				Function fn)
+		{
+			return this->tree_.template for_each_overlap<Function, reference>(
+					low, high, false, fn);
+		}
+
+		template <class Function>
+		Function for_each_overlap(point_type const& low, point_type const& high,
+				Function fn) const
+		{
+			return this->tree_.template for_each_overlap<Function,
+					const_reference>(low, high, false, fn);
+		}
+
+		// Calls fn, in order, on the elements whose interval contains point.
+		template <class Function>
+		Function for_each_containing(point_type const& point, Function fn)
+		{
+			return this->tree_.template for_each_overlap<Function, reference>(
+					point, point, true, fn);
+		}
+
+		template <class Function>
+		Function for_each_containing(point_type const& point, Function fn) const
+		{
+			return this->tree_.template for_each_overlap<Function,
+					const_reference>(point, point, true, fn);
+		}
+
+		allocator_type get_allocator() const
+		{
+			return allocator_type(this->tree_.get_allocator());
+		}
+	};
+
+	template< class Key, class T, class Compare, class Alloc >
+	bool operator==(ft::interval_map<Key,T,Compare,Alloc> const& lhs,
+			ft::interval_map<Key,T,Compare,Alloc> const& rhs)
+	{
+		if (lhs.size() != rhs.size()) {
+			return false;
+		}
+		return ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+	}
+
+	template< class Key, class T, class Compare, class Alloc >
+	bool operator!=(ft::interval_map<Key,T,Compare,Alloc> const& lhs,
+			ft::interval_map<Key,T,Compare,Alloc> const& rhs)
+	{
+		return !(lhs == rhs);
+	}
+
+	template< class Key, class T, class Compare, class Alloc >
+	bool operator<(ft::interval_map<Key,T,Compare,Alloc> const& lhs,
+			ft::interval_map<Key,T,Compare,Alloc> const& rhs)
+	{
+		return ft::lexicographical_compare(lhs.begin(), lhs.end(),
+				rhs.begin(), rhs.end());
+	}
+
+	template< class Key, class T, class Compare, class Alloc >
+	bool operator<=(ft::interval_map<Key,T,Compare,Alloc> const& lhs,
+			ft::interval_map<Key,T,Compare,Alloc> const& rhs)
+	{
+		return !(rhs < lhs);
+	}
+
+	template< class Key, class T, class Compare, class Alloc >
+	bool operator>(ft::interval_map<Key,T,Compare,Alloc> const& lhs,
+			ft::interval_map<Key,T,Compare,Alloc> const& rhs)
+	{
+		return rhs < lhs;
+	}
+
+	template< class Key, class T, class Compare, class Alloc >
+	bool operator>=(ft::interval_map<Key,T,Compare,Alloc> const& lhs,
+			ft::interval_map<Key,T,Compare,Alloc> const& rhs)
+	{
+		return !(lhs < rhs);
+	}
+
+	template< class Key, class T, class Compare, class Alloc >
+	void swap(ft::interval_map<Key,T,Compare,Alloc>& lhs,
+			ft::interval_map<Key,T,Compare,Alloc>& rhs)
+	{
+		lhs.swap(rhs);
+		return;
+	}
+}
+
+#endif
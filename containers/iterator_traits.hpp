@@ -4,6 +4,9 @@
 #include <cstddef>
 #include <iterator>
 
+#include "enable_if.hpp"
+#include "type_traits.hpp"
+
 namespace ft
 {
 	template <class Iterator>
@@ -38,6 +41,134 @@ namespace ft
 		typedef T const& reference;
 		typedef std::random_access_iterator_tag iterator_category;
 	};
+
+	// Advertised as iterator_concept by the iterators over contiguous
+	// storage, like the C++20 tag.
+	struct contiguous_iterator_tag : std::random_access_iterator_tag
+	{
+	};
+
+	template <class Iterator>
+	class reverse_iterator;
+
+	// value is true for the iterators over contiguous storage, whose element
+	// address is given by address(it). reversed is set for reverse_iterators
+	// over such iterators, their address(it) is one past their element so
+	// that a reversed [first, last) spans [address(last), address(first)).
+	// next(p) returns the element at p and steps p in the iterator order, to
+	// walk a range from address(first) to address(last) on raw pointers.
+	template <class Iterator, class Enable = void>
+	struct contiguous_iterator_traits
+	{
+		static bool const value = false;
+		static bool const reversed = false;
+		typedef void value_type;
+	};
+
+	template <class T>
+	struct contiguous_iterator_traits<T*>
+	{
+		static bool const value = true;
+		static bool const reversed = false;
+		typedef typename ft::remove_const<T>::type value_type;
+		typedef T* pointer;
+
+		static pointer address(T* it)
+		{
+			return it;
+		}
+
+		static pointer next(pointer& p)
+		{
+			return p++;
+		}
+	};
+
+	template <class Iterator>
+	struct contiguous_iterator_traits<Iterator, typename ft::enable_if<
+		ft::is_same<typename Iterator::iterator_concept,
+		ft::contiguous_iterator_tag>::value>::type>
+	{
+		static bool const value = true;
+		static bool const reversed = false;
+		typedef typename Iterator::value_type value_type;
+		typedef typename Iterator::pointer pointer;
+
+		static pointer address(Iterator const& it)
+		{
+			return it.operator->();
+		}
+
+		static pointer next(pointer& p)
+		{
+			return p++;
+		}
+	};
+
+	template <class Iterator>
+	struct contiguous_iterator_traits< ft::reverse_iterator<Iterator>,
+		typename ft::enable_if<ft::contiguous_iterator_traits<Iterator>::value
+		&& ft::contiguous_iterator_traits<Iterator>::reversed == false>::type >
+	{
+		typedef ft::contiguous_iterator_traits<Iterator> base_traits;
+
+		static bool const value = true;
+		static bool const reversed = true;
+		typedef typename base_traits::value_type value_type;
+		typedef typename base_traits::pointer pointer;
+
+		static pointer address(ft::reverse_iterator<Iterator> const& it)
+		{
+			return base_traits::address(it.base());
+		}
+
+		static pointer next(pointer& p)
+		{
+			return --p;
+		}
+	};
+
+	// Both iterators walk forward over contiguous storage of a same integral
+	// type, so their ranges compare and copy as raw memory.
+	template <class Iterator1, class Iterator2>
+	struct is_memory_compatible
+	{
+		typedef ft::contiguous_iterator_traits<Iterator1> traits1;
+		typedef ft::contiguous_iterator_traits<Iterator2> traits2;
+
+		static bool const value = traits1::value && traits2::value
+			&& traits1::reversed == false && traits2::reversed == false
+			&& ft::is_same<typename traits1::value_type,
+				typename traits2::value_type>::value
+			&& ft::is_integral<typename traits1::value_type>::value;
+	};
+
+	// Both iterators walk forward over contiguous storage of a same bitwise
+	// copyable type, so their ranges copy with memcpy.
+	template <class Iterator1, class Iterator2>
+	struct is_bitwise_copy_compatible
+	{
+		typedef ft::contiguous_iterator_traits<Iterator1> traits1;
+		typedef ft::contiguous_iterator_traits<Iterator2> traits2;
+
+		static bool const value = traits1::value && traits2::value
+			&& traits1::reversed == false && traits2::reversed == false
+			&& ft::is_same<typename traits1::value_type,
+				typename traits2::value_type>::value
+			&& ft::is_bitwise_copyable<typename traits1::value_type>::value;
+	};
+
+	// Both iterators are contiguous and at least one of them is reversed,
+	// their ranges are walked with next on raw pointers.
+	template <class Iterator1, class Iterator2>
+	struct is_reversed_contiguous_pair
+	{
+		typedef ft::contiguous_iterator_traits<Iterator1> traits1;
+		typedef ft::contiguous_iterator_traits<Iterator2> traits2;
+
+		static bool const value = traits1::value && traits2::value
+			&& (traits1::reversed == true || traits2::reversed == true);
+	};
 }
 
 #endif
@@ -0,0 +1,31 @@
+#ifndef KEY_OF_VALUE_HPP
+#define KEY_OF_VALUE_HPP
+
+namespace ft
+{
+	template <class T>
+	struct identity
+	{
+		typedef T argument_type;
+		typedef T result_type;
+
+		T const& operator()(T const& x) const
+		{
+			return x;
+		}
+	};
+
+	template <class Pair>
+	struct select_first
+	{
+		typedef Pair argument_type;
+		typedef typename Pair::first_type result_type;
+
+		typename Pair::first_type const& operator()(Pair const& x) const
+		{
+			return x.first;
+		}
+	};
+}
+
+#endif
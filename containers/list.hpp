@@ -4,8 +4,10 @@
 #include <iterator>
 #include <cstddef>
 #include <memory>
+#include <utility>
 
 #include "enable_if.hpp"
+#include "type_traits.hpp"
 #include "reverse_iterator.hpp"
 #include "iterator_traits.hpp"
 #include "comparaison.hpp"
@@ -299,6 +301,27 @@ namespace ft
 			return *this;
 		}
 
+#if __cplusplus >= 201103L
+		list(list&& x) :
+			allocator_(x.allocator_),
+			ghost_node_(this->allocator_node_.allocate(1))
+		{
+			this->ghost_node_->prev = this->ghost_node_;
+			this->ghost_node_->next = this->ghost_node_;
+			this->swap(x);
+			return;
+		}
+
+		list& operator=(list&& x)
+		{
+			if (this != &x) {
+				this->clear();
+				this->swap(x);
+			}
+			return *this;
+		}
+#endif
+
 		iterator begin()
 		{
 			return iterator(this->ghost_node_->next);
@@ -385,9 +408,7 @@ namespace ft
 				typename ft::enable_if<!ft::is_integral<InputIterator>::value, bool>::type = true)
 		{
 			this->clear();
-			for (InputIterator it = first, ite = last; it != ite; ++it) {
-				this->push_back(*it);
-			}
+			this->insert_range(this->end(), first, last);
 			return;
 		}
 
@@ -412,9 +433,30 @@ namespace ft
 			return;
 		}
 
+#if __cplusplus >= 201103L
+		void push_front(value_type&& val)
+		{
+			this->emplace_front(std::move(val));
+			return;
+		}
+
+		template <class... Args>
+		void emplace_front(Args&&... args)
+		{
+			doubly_linked_list* new_elem = this->allocator_node_.allocate(1);
+			std::allocator_traits<allocator_type>::construct(this->allocator_,
+					&new_elem->val, std::forward<Args>(args)...);
+			new_elem->prev = this->ghost_node_;
+			new_elem->next = this->ghost_node_->next;
+			this->ghost_node_->next->prev = new_elem;
+			this->ghost_node_->next = new_elem;
+			return;
+		}
+#endif
+
 		void pop_front()
 		{
-			this->allocator_.destroy(&this->ghost_node_->next->val);
+			this->destroy_value(&this->ghost_node_->next->val);
 			doubly_linked_list* old_front = this->ghost_node_->next;
 			this->ghost_node_->next = old_front->next;
 			old_front->next->prev = this->ghost_node_;
@@ -433,9 +475,30 @@ namespace ft
 			return;
 		}
 
+#if __cplusplus >= 201103L
+		void push_back(value_type&& val)
+		{
+			this->emplace_back(std::move(val));
+			return;
+		}
+
+		template <class... Args>
+		void emplace_back(Args&&... args)
+		{
+			doubly_linked_list* new_elem = this->allocator_node_.allocate(1);
+			std::allocator_traits<allocator_type>::construct(this->allocator_,
+					&new_elem->val, std::forward<Args>(args)...);
+			new_elem->prev = this->ghost_node_->prev;
+			new_elem->next = this->ghost_node_;
+			this->ghost_node_->prev->next = new_elem;
+			this->ghost_node_->prev = new_elem;
+			return;
+		}
+#endif
+
 		void pop_back()
 		{
-			this->allocator_.destroy(&this->ghost_node_->prev->val);
+			this->destroy_value(&this->ghost_node_->prev->val);
 			doubly_linked_list* old_back = this->ghost_node_->prev;
 			this->ghost_node_->prev = old_back->prev;
 			old_back->prev->next = this->ghost_node_;
@@ -468,9 +531,7 @@ namespace ft
 		void insert(iterator position, InputIterator first, InputIterator last,
 				typename ft::enable_if<!ft::is_integral<InputIterator>::value, bool>::type = true)
 		{
-			for (InputIterator it = first, ite = last; it != ite; ++it) {
-				this->insert(position, *it);
-			}
+			this->insert_range(position, first, last);
 			return;
 		}
 
@@ -479,7 +540,7 @@ namespace ft
 			doubly_linked_list* node = position.node_;
 			node->prev->next = node->next;
 			node->next->prev = node->prev;
-			this->allocator_.destroy(&node->val);
+			this->destroy_value(&node->val);
 			++position;
 			this->allocator_node_.deallocate(node, 1);
 			return position;
@@ -525,7 +586,7 @@ namespace ft
 			while (current != this->ghost_node_)
 			{
 				doubly_linked_list* next = current->next;
-				this->allocator_.destroy(&current->val);
+				this->destroy_value(&current->val);
 				this->allocator_node_.deallocate(current, 1);
 				current = next;
 			}
@@ -782,6 +843,45 @@ namespace ft
 			merge_halves(first_node, right_first_node, size, comp);
 			return;
 		}
+
+		// With the default allocator, trivially destructible values are left
+		// as is.
+		void destroy_value(value_type* val)
+		{
+			if (ft::is_trivially_destructible<value_type>::value == false
+					|| ft::is_default_allocator<Alloc, T>::value == false) {
+				this->allocator_.destroy(val);
+			}
+			return;
+		}
+
+		template <class InputIterator>
+		typename ft::enable_if<ft::contiguous_iterator_traits<
+			InputIterator>::reversed == false>::type
+		insert_range(iterator position, InputIterator first,
+				InputIterator last)
+		{
+			for (InputIterator it = first, ite = last; it != ite; ++it) {
+				this->insert(position, *it);
+			}
+			return;
+		}
+
+		// Reversed contiguous ranges are read from their raw pointers.
+		template <class InputIterator>
+		typename ft::enable_if<ft::contiguous_iterator_traits<
+			InputIterator>::reversed>::type
+		insert_range(iterator position, InputIterator first,
+				InputIterator last)
+		{
+			typedef ft::contiguous_iterator_traits<InputIterator> traits;
+			typename traits::pointer it = traits::address(first);
+			typename traits::pointer ite = traits::address(last);
+			while (it != ite) {
+				this->insert(position, *traits::next(it));
+			}
+			return;
+		}
 	};
 
 	template <class T, class Alloc>
@@ -802,26 +902,29 @@ namespace ft
 	template <class T, class Alloc>
 	bool operator<(ft::list<T,Alloc> const& lhs, ft::list<T,Alloc> const& rhs)
 	{
-		return ft::lexicographical_compare(lhs.begin(), lhs.end(),
-				rhs.begin(), rhs.end());
+		return ft::lexicographical_compare_three_way(lhs.begin(), lhs.end(),
+				rhs.begin(), rhs.end()) < 0;
 	}
 
 	template <class T, class Alloc>
 	bool operator<=(ft::list<T,Alloc> const& lhs, ft::list<T,Alloc> const& rhs)
 	{
-		return !(rhs < lhs);
+		return ft::lexicographical_compare_three_way(lhs.begin(), lhs.end(),
+				rhs.begin(), rhs.end()) <= 0;
 	}
 
 	template <class T, class Alloc>
 	bool operator>(ft::list<T,Alloc> const& lhs, ft::list<T,Alloc> const& rhs)
 	{
-		return rhs < lhs;
+		return ft::lexicographical_compare_three_way(lhs.begin(), lhs.end(),
+				rhs.begin(), rhs.end()) > 0;
 	}
 
 	template <class T, class Alloc>
 	bool operator>=(ft::list<T,Alloc> const& lhs, ft::list<T,Alloc> const& rhs)
 	{
-		return !(lhs < rhs);
+		return ft::lexicographical_compare_three_way(lhs.begin(), lhs.end(),
+				rhs.begin(), rhs.end()) >= 0;
 	}
 
 	template <class T, class Alloc>
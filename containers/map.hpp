@@ -1,23 +1,17 @@
 #ifndef MAP_HPP
 #define MAP_HPP
 
-#define RESET   "\033[0m"
-#define RED     "\033[31m"
-
-#include <iostream>
-
-#include <iterator>
 #include <cstddef>
 #include <memory>
+#include <utility>
 
 #include "enable_if.hpp"
-#include "reverse_iterator.hpp"
-#include "iterator_traits.hpp"
 #include "comparaison.hpp"
 
 #include "less.hpp"
 #include "pair.hpp"
-#include "rbt_node.hpp"
+#include "key_of_value.hpp"
+#include "rb_tree.hpp"
 
 namespace ft
 {
@@ -36,20 +30,21 @@ namespace ft
 		typedef typename allocator_type::const_reference const_reference;
 		typedef typename allocator_type::pointer pointer;
 		typedef typename allocator_type::const_pointer const_pointer;
-		class iterator;
-		class const_iterator;
-		typedef ft::reverse_iterator<iterator> reverse_iterator;
-		typedef ft::reverse_iterator<const_iterator> const_reverse_iterator;
 
 	protected:
-		typedef rbt_node<value_type> rbt_node;
-		typedef typename allocator_type::template rebind<rbt_node>::other
-			node_allocator_type;
+		typedef ft::rb_tree<key_type, value_type, ft::select_first<value_type>,
+				key_compare, allocator_type> tree_type;
+		typedef typename tree_type::rbt_node rbt_node;
+		typedef typename tree_type::node_allocator_type node_allocator_type;
 
 	public:
-		typedef typename ft::iterator_traits<iterator>::difference_type difference_type;
-		typedef std::size_t size_type;
-	
+		typedef typename tree_type::iterator iterator;
+		typedef typename tree_type::const_iterator const_iterator;
+		typedef typename tree_type::reverse_iterator reverse_iterator;
+		typedef typename tree_type::const_reverse_iterator const_reverse_iterator;
+		typedef typename tree_type::difference_type difference_type;
+		typedef typename tree_type::size_type size_type;
+
 		class value_compare
 		{
 		protected:
@@ -72,282 +67,112 @@ namespace ft
 			}
 		};
 
-		class iterator : std::bidirectional_iterator_tag
+		// Owns a node extracted from a map until it is inserted in one. There
+		// is no move in C++98 so copies transfer the ownership, like
+		// std::auto_ptr.
+		class node_type
 		{
 		public:
-			typedef typename ft::iterator_traits<pointer>::value_type value_type;
-			typedef typename ft::iterator_traits<pointer>::difference_type difference_type;
-			typedef pointer pointer;
-			typedef typename ft::iterator_traits<pointer>::reference reference;
-			typedef std::bidirectional_iterator_tag iterator_category;
+			typedef Key key_type;
+			typedef T mapped_type;
+			typedef Alloc allocator_type;
 
-			rbt_node* ptr_;
+			mutable rbt_node* node_;
+			node_allocator_type node_alloc_;
 
-			iterator() :
-				ptr_(NULL)
+			node_type() :
+				node_(NULL),
+				node_alloc_()
 			{
 				return;
 			}
 
-			iterator(rbt_node* ptr) :
-				ptr_(ptr)
+			node_type(rbt_node* node, node_allocator_type const& node_alloc) :
+				node_(node),
+				node_alloc_(node_alloc)
 			{
 				return;
 			}
 
-			iterator(iterator const& src) :
-				ptr_(src.ptr_)
+			node_type(node_type const& src) :
+				node_(src.node_),
+				node_alloc_(src.node_alloc_)
 			{
+				src.node_ = NULL;
 				return;
 			}
 
-			virtual ~iterator()
+			~node_type()
 			{
+				this->reset(NULL);
 				return;
 			}
 
-			iterator& operator=(iterator const& rhs)
+			node_type& operator=(node_type const& rhs)
 			{
-				this->ptr_ = rhs.ptr_;
+				if (this != &rhs) {
+					rbt_node* node = rhs.node_;
+					rhs.node_ = NULL;
+					this->reset(node);
+					this->node_alloc_ = rhs.node_alloc_;
+				}
 				return *this;
 			}
 
-			bool operator==(const_iterator const& rhs) const
+			bool empty() const
 			{
-				return this->ptr_ == rhs.ptr_;
+				return this->node_ == NULL;
 			}
 
-			bool operator!=(const_iterator const& rhs) const
+			key_type& key() const
 			{
-				return this->ptr_ != rhs.ptr_;
+				return const_cast<key_type&>(this->node_->val.first);
 			}
 
-			reference operator*() const
+			mapped_type& mapped() const
 			{
-				return this->ptr_->val;
+				return this->node_->val.second;
 			}
 
-			pointer operator->() const
+			allocator_type get_allocator() const
 			{
-				return &this->ptr_->val;
-			}
-
-			iterator& operator++()
-			{
-				if (this->ptr_->right->right) {
-					this->ptr_ = this->ptr_->right;
-					if (this->ptr_->left->right != this->ptr_) {
-						while (this->ptr_->left->left) {
-							this->ptr_ = this->ptr_->left;
-						}
-					}
-				}
-				else {
-					rbt_node* parent = this->ptr_->parent;
-					while (parent->left != this->ptr_) {
-						this->ptr_ = parent;
-						parent = this->ptr_->parent;
-					}
-					this->ptr_ = parent;
-				}
-				return *this;
+				return allocator_type(this->node_alloc_);
 			}
 
-			iterator operator++(int)
+			rbt_node* release() const
 			{
-				iterator tmp = *this;
-				++(*this);
-				return tmp;
+				rbt_node* node = this->node_;
+				this->node_ = NULL;
+				return node;
 			}
 
-			iterator& operator--()
+		private:
+			void reset(rbt_node* node)
 			{
-				if (this->ptr_->left->left) {
-					this->ptr_ = this->ptr_->left;
-					if (this->ptr_->right->left != this->ptr_) {
-						while (this->ptr_->right->right) {
-							this->ptr_ = this->ptr_->right;
-						}
-					}
+				if (this->node_ != NULL) {
+					this->node_alloc_.destroy(this->node_);
+					this->node_alloc_.deallocate(this->node_, 1);
 				}
-				else {
-					rbt_node* parent = this->ptr_->parent;
-					while (parent->right != this->ptr_) {
-						this->ptr_ = parent;
-						parent = this->ptr_->parent;
-					}
-					this->ptr_ = parent;
-				}
-				return *this;
-			}
-
-			iterator operator--(int)
-			{
-				iterator tmp = *this;
-				--(*this);
-				return tmp;
+				this->node_ = node;
+				return;
 			}
 		};
 
-		class const_iterator : std::bidirectional_iterator_tag
+		struct insert_return_type
 		{
-		public:
-			typedef typename ft::iterator_traits<const_pointer>::value_type value_type;
-			typedef typename ft::iterator_traits<const_pointer>::difference_type difference_type;
-			typedef const_pointer pointer;
-			typedef typename ft::iterator_traits<const_pointer>::reference reference;
-			typedef std::bidirectional_iterator_tag iterator_category;
-
-			rbt_node* ptr_;
-
-			const_iterator() :
-				ptr_(NULL)
-			{
-				return;
-			}
-
-			const_iterator(rbt_node* ptr) :
-				ptr_(ptr)
-			{
-				return;
-			}
-
-			const_iterator(iterator const& src) :
-				ptr_(src.ptr_)
-			{
-				return;
-			}
-
-			const_iterator(const_iterator const& src) :
-				ptr_(src.ptr_)
-			{
-				return;
-			}
-
-			virtual ~const_iterator()
-			{
-				return;
-			}
-
-			const_iterator& operator=(iterator const& rhs)
-			{
-				this->ptr_ = rhs.ptr_;
-				return *this;
-			}
-
-
-			const_iterator& operator=(const_iterator const& rhs)
-			{
-				this->ptr_ = rhs.ptr_;
-				return *this;
-			}
-
-			bool operator==(const_iterator const& rhs) const
-			{
-				return this->ptr_ == rhs.ptr_;
-			}
-
-			bool operator!=(const_iterator const& rhs) const
-			{
-				return this->ptr_ != rhs.ptr_;
-			}
-
-			reference operator*() const
-			{
-				return this->ptr_->val;
-			}
-
-			pointer operator->() const
-			{
-				return &this->ptr_->val;
-			}
-
-			const_iterator& operator++()
-			{
-				if (this->ptr_->right->right) {
-					this->ptr_ = this->ptr_->right;
-					if (this->ptr_->left->right != this->ptr_) {
-						while (this->ptr_->left->left) {
-							this->ptr_ = this->ptr_->left;
-						}
-					}
-				}
-				else {
-					rbt_node* parent = this->ptr_->parent;
-					while (parent->left != this->ptr_) {
-						this->ptr_ = parent;
-						parent = this->ptr_->parent;
-					}
-					this->ptr_ = parent;
-				}
-				return *this;
-			}
-
-			const_iterator operator++(int)
-			{
-				const_iterator tmp = *this;
-				++(*this);
-				return tmp;
-			}
-
-			const_iterator& operator--()
-			{
-				if (this->ptr_->left->left) {
-					this->ptr_ = this->ptr_->left;
-					if (this->ptr_->right->left != this->ptr_) {
-						while (this->ptr_->right->right) {
-							this->ptr_ = this->ptr_->right;
-						}
-					}
-				}
-				else {
-					rbt_node* parent = this->ptr_->parent;
-					while (parent->right != this->ptr_) {
-						this->ptr_ = parent;
-						parent = this->ptr_->parent;
-					}
-					this->ptr_ = parent;
-				}
-				return *this;
-			}
-
-			const_iterator operator--(int)
-			{
-				const_iterator tmp = *this;
-				--(*this);
-				return tmp;
-			}
+			iterator position;
+			bool inserted;
+			node_type node;
 		};
-	
+
 	protected:
-		key_compare comp_;
-		allocator_type alloc_;
-		node_allocator_type node_alloc_;
-		rbt_node* ghost_node_;
-		rbt_node* nil_node_;
-		rbt_node* root_node_;
-		size_type size_;
+		tree_type tree_;
 
 	public:
-
 		explicit map(key_compare const& comp = key_compare(),
 				allocator_type const& alloc = allocator_type()) :
-			comp_(comp),
-			alloc_(alloc),
-			node_alloc_(),
-			ghost_node_(this->node_alloc_.allocate(1)),
-			nil_node_(this->node_alloc_.allocate(1)),
-			root_node_(this->nil_node_),
-			size_(0)
+			tree_(comp, alloc)
 		{
-			this->ghost_node_->parent = this->ghost_node_;
-			this->ghost_node_->left = this->ghost_node_;
-			this->ghost_node_->right = this->ghost_node_;
-			this->ghost_node_->is_red = false;
-			this->nil_node_->is_red = false;
-			this->nil_node_->parent = NULL;
-			this->nil_node_->left = NULL;
-			this->nil_node_->right = NULL;
 			return;
 		}
 
@@ -355,119 +180,96 @@ namespace ft
 		map(InputIterator first, InputIterator last,
 				key_compare const& comp = key_compare(),
 				allocator_type const& alloc = allocator_type()) :
-			comp_(comp),
-			alloc_(alloc),
-			node_alloc_(),
-			ghost_node_(this->node_alloc_.allocate(1)),
-			nil_node_(this->node_alloc_.allocate(1)),
-			root_node_(this->nil_node_),
-			size_(0)
+			tree_(comp, alloc)
 		{
-			this->ghost_node_->parent = this->ghost_node_;
-			this->ghost_node_->left = this->ghost_node_;
-			this->ghost_node_->right = this->ghost_node_;
-			this->ghost_node_->is_red = false;
-			this->nil_node_->is_red = false;
-			this->nil_node_->parent = NULL;
-			this->nil_node_->left = NULL;
-			this->nil_node_->right = NULL;
 			this->insert(first, last);
 			return;
 		}
 
 		map(map const& x) :
-			comp_(x.comp_),
-			alloc_(x.alloc_),
-			node_alloc_(x.node_alloc_),
-			ghost_node_(this->node_alloc_.allocate(1)),
-			nil_node_(this->node_alloc_.allocate(1)),
-			root_node_(this->nil_node_),
-			size_(0)
+			tree_(x.tree_)
 		{
-			this->ghost_node_->parent = this->ghost_node_;
-			this->ghost_node_->left = this->ghost_node_;
-			this->ghost_node_->right = this->ghost_node_;
-			this->ghost_node_->is_red = false;
-			this->nil_node_->is_red = false;
-			this->nil_node_->parent = NULL;
-			this->nil_node_->left = NULL;
-			this->nil_node_->right = NULL;
-			*this = x;
 			return;
 		}
 
 		~map()
 		{
-			this->clear();
-			this->node_alloc_.deallocate(this->ghost_node_, 1);
-			this->node_alloc_.deallocate(this->nil_node_, 1);
 			return;
 		}
 
 		map& operator=(map const& x)
 		{
-			this->clear();
-			this->comp_ = x.comp_;
-			for (const_iterator cit = x.begin(), cite = x.end();
-					cit != cite; ++cit) {
-				this->insert(*cit);
-			}
+			this->tree_ = x.tree_;
 			return *this;
 		}
 
+#if __cplusplus >= 201103L
+		map(map&& x) :
+			tree_(std::move(x.tree_))
+		{
+			return;
+		}
+
+		map& operator=(map&& x)
+		{
+			this->tree_ = std::move(x.tree_);
+			return *this;
+		}
+#endif
+
 		iterator begin()
 		{
-			return this->begin_impl();
+			return this->tree_.begin();
 		}
 
 		const_iterator begin() const
 		{
-			return const_iterator(this->begin_impl());
+			return this->tree_.begin();
 		}
 
 		iterator end()
 		{
-			return this->end_impl();
+			return this->tree_.end();
 		}
 
 		const_iterator end() const
 		{
-			return const_iterator(this->end_impl());
+			return this->tree_.end();
 		}
 
 		reverse_iterator rbegin()
 		{
-			return reverse_iterator(this->ghost_node_);
+			return this->tree_.rbegin();
 		}
 
 		const_reverse_iterator rbegin() const
 		{
-			return const_reverse_iterator(this->ghost_node_);
+			return this->tree_.rbegin();
 		}
 
 		reverse_iterator rend()
 		{
-			return reverse_iterator(this->ghost_node_->right);
+			return this->tree_.rend();
 		}
 
 		const_reverse_iterator rend() const
 		{
-			return const_reverse_iterator(this->ghost_node_->right);
+			return this->tree_.rend();
 		}
 
 		bool empty() const
 		{
-			return this->size_ == 0;
+			return this->tree_.empty();
 		}
 
 		size_type size() const
 		{
-			return this->size_;
+			return this->tree_.size();
 		}
 
 		size_type max_size() const
 		{
-			return this->node_alloc_.max_size();
+			return this->tree_.max_size();
 		}
 
 		mapped_type& operator[](key_type const& k)
@@ -477,704 +279,239 @@ namespace ft
 
 		ft::pair<iterator,bool> insert(value_type const& val)
 		{
-			if (this->root_node_ == this->nil_node_) {
-				return this->insert_to_root(val);
-			}
-			rbt_node* node = this->root_node_;
-			while (1) {
-				if (this->comp_(val.first, node->val.first) == true) {
-					if (node->left == this->nil_node_
-							|| node->left == this->ghost_node_) {
-						return insert_node(node, &node->left, val);
-					}
-					node = node->left;
-				}
-				else if (this->comp_(node->val.first, val.first) == true) {
-					if (node->right == this->nil_node_
-							|| node->right == this->ghost_node_) {
-						return insert_node(node, &node->right, val);
-					}
-					node = node->right;
-				}
-				else {
-					return ft::pair<iterator,bool>(node, false);
-				}
-			}
+			return this->tree_.insert_unique(val);
 		}
 
 		iterator insert(iterator position, value_type const& val)
 		{
-			if (this->root_node_ == this->nil_node_) {
-				return this->insert_to_root(val).first;
-			}
-			const_iterator previous = position;
-			previous--;
-			const_iterator next = position;
-			next++;
-			if ((previous.ptr_ == this->ghost_node_
-						|| this->comp_(previous->first, val.first) == true)
-					&& (position.ptr_ == this->ghost_node_
-						|| this->comp_(val.first, position->first) == true)) {
-				if (position.ptr_ == this->ghost_node_) {
-					return this->insert_node(previous.ptr_,
-							&previous.ptr_->right, val).first;
-				}
-				else if (position.ptr_->left == this->nil_node_
-							|| position.ptr_->left == this->ghost_node_) {
-					return this->insert_node(position.ptr_,
-							&position.ptr_->left, val).first;
-				}
-				else {
-					return this->insert(iterator(position.ptr_->left), val);
-				}
-			}
-			else if ((position.ptr_ == this->ghost_node_
-						|| this->comp_(position->first, val.first) == true)
-					&& (next.ptr_ == this->ghost_node_
-						|| this->comp_(val.first, next->first) == true)) {
-				if (position.ptr_ == this->ghost_node_) {
-					return this->insert_node(next.ptr_,
-							&next.ptr_->left, val).first;
-				}
-				else if (position.ptr_->right == this->nil_node_
-						|| position.ptr_->right == this->ghost_node_) {
-					return this->insert_node(position.ptr_,
-							&position.ptr_->right, val).first;
-				}
-				else {
-					return this->insert(iterator(position.ptr_->right), val);
-				}
-			}
-			else {
-				return this->insert(val).first;
-			}
+			return this->tree_.insert_unique(position, val);
 		}
 
 		template <class InputIterator>
 		void insert(InputIterator first, InputIterator last)
 		{
 			while (first != last) {
-				this->insert(*first);
+				this->tree_.insert_unique(*first);
 				++first;
 			}
 			return;
 		}
 
-		void erase(iterator position)
-		{
-			rbt_node* node = position.ptr_;
-			rbt_node* new_min = NULL;
-			if (node->left == this->ghost_node_) {
-				iterator new_min_position = position;
-				++new_min_position;
-				new_min = new_min_position.ptr_;
-			}
-			rbt_node* new_max = NULL;
-			if (node->right == this->ghost_node_) {
-				iterator new_max_position = position;
-				--new_max_position;
-				new_max = new_max_position.ptr_;
-			}
-			bool original_is_red = node->is_red;
-			rbt_node* violating_node = NULL;
-			if (node->left == this->nil_node_
-					|| node->left == this->ghost_node_) {
-				this->substitute_node(node, node->right);
-				violating_node = node->right;
-				violating_node->parent = node->parent;
-
-			}
-			else if (node->right == this->nil_node_
-					|| node->right == this->ghost_node_) {
-				this->substitute_node(node, node->left);
-				violating_node = node->left;
-				violating_node->parent = node->parent;
-			}
-			else {
-				rbt_node* substitute = node->right;
-				while (substitute->left != this->nil_node_
-						&& substitute->left != this->ghost_node_) {
-					substitute = substitute->left;
-				}
-				original_is_red = substitute->is_red;
-				violating_node = substitute->right;
-				if (substitute->parent == node) {
-					violating_node->parent = substitute;
-				}
-				else {
-					this->substitute_node(substitute, substitute->right);
-					substitute->right = node->right;
-					substitute->right->parent = substitute;
-				}
-				this->substitute_node(node, substitute);
-				substitute->left = node->left;
-				substitute->left->parent = substitute;
-				substitute->is_red = node->is_red;
-			}
-			this->node_alloc_.deallocate(node, 1);
-			if (original_is_red == false) {
-				fix_deletion(violating_node);
-			}
-			if (new_min) {
-				new_min->left = this->ghost_node_;
-				this->ghost_node_->right = new_min;
-			}
-			if (new_max) {
-				new_max->right = this->ghost_node_;
-				this->ghost_node_->left = new_max;
-			}
-			this->size_--;
-			return;
-		}
-
-		size_type erase(key_type const& k)
-		{
-			rbt_node* node = this->root_node_;
-			while (node != this->nil_node_ && node != this->ghost_node_) {
-				if (this->comp_(k, node->val.first) == true) {
-					node = node->left;
-				}
-				else if (this->comp_(node->val.first, k) == true) {
-					node = node->right;
-				}
-				else {
-					this->erase(iterator(node));
-					return 1;
-				}
-			}
-			return 0;
-		}
-
-		void erase(iterator first, iterator last)
-		{
-			while (first != last) {
-				iterator to_delete = first;
-				first++;
-				this->erase(to_delete);
-			}
-			return;
-		}
-
-		void swap(map& x)
+		// The value is constructed in its node. From a key_type and a mapped
+		// value the key is looked up first, a duplicate allocates nothing.
+#if __cplusplus >= 201103L
+		template <class... Args>
+		ft::pair<iterator,bool> emplace(Args&&... args)
 		{
-			key_compare key_compare_tmp = this->comp_;
-			this->comp_ = x.comp_;
-			x.comp_ = key_compare_tmp;
-			allocator_type allocator_tmp = this->alloc_;
-			this->alloc_ = x.alloc_;
-			x.alloc_ = allocator_tmp;
-			node_allocator_type node_allocator_tmp = this->node_alloc_;
-			this->node_alloc_ = x.node_alloc_;
-			x.node_alloc_ = node_allocator_tmp;
-			rbt_node* node_tmp = this->ghost_node_;
-			this->ghost_node_ = x.ghost_node_;
-			x.ghost_node_ = node_tmp;
-			node_tmp = this->nil_node_;
-			this->nil_node_ = x.nil_node_;
-			x.nil_node_ = node_tmp;
-			node_tmp = this->root_node_;
-			this->root_node_ = x.root_node_;
-			x.root_node_ = node_tmp;
-			size_type size_tmp = this->size_;
-			this->size_ = x.size_;
-			x.size_ = size_tmp;
+			return this->tree_.emplace_unique(std::forward<Args>(args)...);
 		}
 
-		void clear()
+		template <class... Args>
+		iterator emplace_hint(iterator position, Args&&... args)
 		{
-			clear_rbt(this->root_node_);
-			this->root_node_ = this->nil_node_;
-			this->ghost_node_->parent = this->ghost_node_;
-			this->ghost_node_->left = this->ghost_node_;
-			this->ghost_node_->right = this->ghost_node_;
-			this->size_ = 0;
+			return this->tree_.emplace_hint_unique(position,
+					std::forward<Args>(args)...);
 		}
-
-		key_compare key_comp() const
+#else
+		template <class A1>
+		ft::pair<iterator,bool> emplace(A1 const& a1)
 		{
-			return this->comp_;
+			return this->tree_.emplace_unique(a1);
 		}
 
-		value_compare value_comp() const
+		template <class A1, class A2>
+		ft::pair<iterator,bool> emplace(A1 const& a1, A2 const& a2)
 		{
-			return value_compare(this->comp_);
+			return this->tree_.emplace_unique(a1, a2);
 		}
 
-		iterator find(key_type const& k)
+		template <class A1>
+		iterator emplace_hint(iterator position, A1 const& a1)
 		{
-			return this->find_impl(k);
+			return this->tree_.emplace_hint_unique(position, a1);
 		}
 
-		const_iterator find(key_type const& k) const
+		template <class A1, class A2>
+		iterator emplace_hint(iterator position, A1 const& a1, A2 const& a2)
 		{
-			return this->find_impl(k);
+			return this->tree_.emplace_hint_unique(position, a1, a2);
 		}
+#endif
 
-		size_type count(key_type const& k) const
+		// Inserts the node of nh without copying its value. When the key is
+		// already present nh keeps the node, else it is left empty.
+		insert_return_type insert(node_type const& nh)
 		{
-			if (this->find(k) != this->end()) {
-				return 1;
+			insert_return_type result;
+			result.inserted = false;
+			if (nh.empty() == true) {
+				result.position = this->end();
+				return result;
 			}
-			return 0;
-		}
-
-		iterator lower_bound(key_type const& k)
-		{
-			return this->lower_bound_impl(k);
+			ft::pair<iterator,bool> inserted
+				= this->tree_.insert_unique_node(nh.node_);
+			result.position = inserted.first;
+			if (inserted.second == false) {
+				result.node = nh;
+				return result;
+			}
+			nh.release();
+			result.inserted = true;
+			return result;
 		}
 
-		const_iterator lower_bound(key_type const& k) const
+		void erase(iterator position)
 		{
-			return const_iterator(this->lower_bound_impl(k));
+			this->tree_.erase(position);
+			return;
 		}
 
-		iterator upper_bound(key_type const& k)
+		size_type erase(key_type const& k)
 		{
-			return this->upper_bound_impl(k);
+			return this->tree_.erase_unique(k);
 		}
 
-		const_iterator upper_bound(key_type const& k) const
+		node_type extract(iterator position)
 		{
-			return const_iterator(this->upper_bound_impl(k));
+			return node_type(this->tree_.extract(position),
+					this->tree_.get_node_allocator());
 		}
 
-		pair<const_iterator,const_iterator> equal_range(key_type const& k) const
+		node_type extract(key_type const& k)
 		{
-			return this->equal_range_impl(k);
+			iterator it = this->find(k);
+			if (it == this->end()) {
+				return node_type();
+			}
+			return this->extract(it);
 		}
 
-		pair<iterator,iterator> equal_range(key_type const& k)
+		void erase(iterator first, iterator last)
 		{
-			return this->equal_range_impl(k);
+			this->tree_.erase_unique(first, last);
+			return;
 		}
 
-		allocator_type get_allocator() const
+		void swap(map& x)
 		{
-			return this->alloc_;
+			this->tree_.swap(x.tree_);
+			return;
 		}
 
-	private:
-		iterator begin_impl() const
+		// Moves the elements whose key is not lower than k to upper, cleared
+		// first. The trees are split in O(log n) but the sizes need the
+		// smaller part to be counted. Both maps must use equal allocators.
+		void split(key_type const& k, map& upper)
 		{
-			return iterator(this->ghost_node_->right);
+			this->tree_.split(k, upper.tree_);
+			return;
 		}
 
-		iterator end_impl() const
+		// Moves the elements of x to the map without copying them. Trees whose
+		// keys are all lower or all greater than the other ones are joined in
+		// O(log n) and x is left empty, otherwise the elements of x are
+		// relinked one by one and those whose key is already present stay in x.
+		void join(map& x)
 		{
-			return iterator(this->ghost_node_);
+			this->tree_.join(x.tree_);
+			return;
 		}
 
-		rbt_node* create_rbt_node(value_type const& val)
+		// Relinks the nodes of source whose key is not in the map, without
+		// copying nor reallocating them. The other ones stay in source.
+		void merge(map& source)
 		{
-			rbt_node* node = this->node_alloc_.allocate(1);
-			this->node_alloc_.construct(node, rbt_node());
-			node->parent = NULL;
-			node->left = this->nil_node_;
-			node->right = this->nil_node_;
-			this->alloc_.construct(&node->val, val);
-			this->size_++;
-			return node;
+			this->tree_.merge_unique(source.tree_);
+			return;
 		}
 
-		ft::pair<iterator, bool> insert_to_root(value_type const& val)
+		void clear()
 		{
-				this->root_node_ = this->create_rbt_node(val);
-				this->root_node_->is_red = false;
-				this->root_node_->left = this->ghost_node_;
-				this->root_node_->right = this->ghost_node_;
-				this->ghost_node_->left = this->root_node_;
-				this->ghost_node_->right = this->root_node_;
-				return ft::pair<iterator,bool>(iterator(this->root_node_),
-						true);
+			this->tree_.clear();
+			return;
 		}
 
-		ft::pair<iterator, bool> insert_node(rbt_node* parent, rbt_node** node_ptr,
-				value_type const& val)
+		key_compare key_comp() const
 		{
-			rbt_node* new_node = this->create_rbt_node(val);
-			if (parent == this->ghost_node_->right
-					&& &parent->left == node_ptr) {
-				this->ghost_node_->right = new_node;
-				new_node->left = this->ghost_node_;
-			}
-			else if (parent == this->ghost_node_->left
-					&& &parent->right == node_ptr) {
-				this->ghost_node_->left = new_node;
-				new_node->right = this->ghost_node_;
-			}
-			new_node->parent = parent;
-			*node_ptr = new_node;
-			fix_insertion(new_node);
-			return ft::pair<iterator,bool>(iterator(new_node), true);
+			return this->tree_.key_comp();
 		}
 
-		void left_rotate_node(rbt_node* node)
+		value_compare value_comp() const
 		{
-			rbt_node* parent = node->parent;
-			rbt_node* right = node->right;
-			if (right->left != this->nil_node_) {
-				right->left->parent = node;
-			}
-			if (parent) {
-				if (parent->right == node) {
-					parent->right = right;
-				}
-				else {
-					parent->left = right;
-				}
-			}
-			else {
-				this->root_node_ = right;
-			}
-			node->parent = right;
-			node->right = right->left;
-			right->parent = parent;
-			right->left = node;
+			return value_compare(this->tree_.key_comp());
 		}
 
-		void right_rotate_node(rbt_node* node)
+		iterator find(key_type const& k)
 		{
-			rbt_node* parent = node->parent;
-			rbt_node* left = node->left;
-			if (left->right != this->nil_node_) {
-				left->right->parent = node;
-			}
-			if (parent) {
-				if (parent->right == node) {
-					parent->right = left;
-				}
-				else {
-					parent->left = left;
-				}
-			}
-			else {
-				this->root_node_ = left;
-			}
-			node->parent = left;
-			node->left = left->right;
-			left->parent = parent;
-			left->right = node;
+			return this->tree_.find(k);
 		}
 
-		void fix_insertion(rbt_node* node)
+		const_iterator find(key_type const& k) const
 		{
-			rbt_node* parent = node->parent;
-			while (parent && parent->is_red == true) {
-				rbt_node* grand_parent = node->get_grand_parent();
-				rbt_node* uncle = node->get_uncle();
-				if (uncle != this->nil_node_ && uncle->is_red == true) {
-					parent->is_red = false;
-					grand_parent->is_red = true;
-					uncle->is_red = false;
-				}
-				else {
-					// triangle cases
-					if (grand_parent->right == parent && parent->left == node) {
-						right_rotate_node(parent);
-						node = parent;
-						parent = node->parent;
-					}
-					else if (grand_parent->left == parent
-							&& parent->right == node) {
-						left_rotate_node(parent);
-						node = parent;
-						parent = node->parent;
-					}
-					// line cases
-					if (grand_parent->right == parent
-							&& parent->right == node) {
-						left_rotate_node(grand_parent);
-						parent->is_red = false;
-						grand_parent->is_red = true;
-					}
-					else if (grand_parent->left == parent
-							&& parent->left == node) {
-						right_rotate_node(grand_parent);
-						parent->is_red = false;
-						grand_parent->is_red = true;
-					}
-				}
-				node = grand_parent;
-				parent = node->parent;
-			}
-			this->root_node_->is_red = false;
-			return;
+			return this->tree_.find(k);
 		}
 
-		rbt_node* get_deletion_substitute(rbt_node* node) const
+		size_type count(key_type const& k) const
 		{
-			if (node->left != this->nil_node_
-					&& node->left != this->ghost_node_) {
-				if (node->right != this->nil_node_
-						&& node->right != this->ghost_node_) {
-					iterator successor_it(node);
-					++successor_it;
-					return successor_it.ptr_;
-				}
-				else {
-					return node->left;
-				}
-			}
-			else {
-				return node->right;
+			if (this->find(k) != this->end()) {
+				return 1;
 			}
+			return 0;
 		}
 
-		void fix_deletion(rbt_node* node)
+		iterator lower_bound(key_type const& k)
 		{
-			rbt_node* sibling = NULL;
-			while (node != this->root_node_ && node->is_red == false) {
-				if (node->parent->left == node) {
-					sibling = node->parent->right;
-					if (sibling->is_red == true)
-					{
-						sibling->is_red = false;
-						node->parent->is_red = true;
-						left_rotate_node(node->parent);
-						sibling = node->parent->right;
-					}
-					if ((sibling->left == this->nil_node_
-								|| sibling->left == this->ghost_node_
-								|| sibling->left->is_red == false)
-							&& (sibling->right == this->nil_node_
-								|| sibling->right == this->ghost_node_
-								|| sibling->right->is_red == false)) {
-						sibling->is_red = true;
-						node = node->parent;
-					}
-					else {
-						if (sibling->right == this->nil_node_
-								|| sibling->right == this->ghost_node_
-								|| sibling->right->is_red == false) {
-							if (sibling->left != this->nil_node_
-									&& sibling->left != this->ghost_node_) {
-								sibling->left->is_red = false;
-							}
-							sibling->is_red = true;
-							right_rotate_node(sibling);
-							sibling = node->parent->right;
-						}
-						sibling->is_red = node->parent->is_red;
-						node->parent->is_red = false;
-						if (sibling->right != this->nil_node_
-								&& sibling->right != this->ghost_node_) {
-							sibling->right->is_red = false;
-						}
-						left_rotate_node(node->parent);
-						node = this->root_node_;
-					}
-				}
-				else {
-					sibling = node->parent->left;
-					if (sibling->is_red == true)
-					{
-						sibling->is_red = false;
-						node->parent->is_red = true;
-						right_rotate_node(node->parent);
-						sibling = node->parent->left;
-					}
-					if ((sibling->right == this->nil_node_
-								|| sibling->right == this->ghost_node_
-								|| sibling->right->is_red == false)
-							&& (sibling->left == this->nil_node_
-								|| sibling->left == this->ghost_node_
-								|| sibling->left->is_red == false)) {
-						sibling->is_red = true;
-						node = node->parent;
-					}
-					else {
-						if (sibling->left == this->nil_node_
-								|| sibling->left == this->ghost_node_
-								|| sibling->left->is_red == false) {
-							if (sibling->right != this->nil_node_
-									&& sibling->right != this->ghost_node_) {
-								sibling->right->is_red = false;
-							}
-							sibling->is_red = true;
-							left_rotate_node(sibling);
-							sibling = node->parent->left;
-						}
-						sibling->is_red = node->parent->is_red;
-						node->parent->is_red = false;
-						if (sibling->left != this->nil_node_
-								&& sibling->left != this->ghost_node_) {
-							sibling->left->is_red = false;
-						}
-						right_rotate_node(node->parent);
-						node = this->root_node_;
-					}
-				}
-			}
-			node->is_red = false;
-			return;
+			return this->tree_.lower_bound(k);
 		}
 
-		void substitute_node(rbt_node* node, rbt_node* substitute)
+		const_iterator lower_bound(key_type const& k) const
 		{
-			if (substitute != this->nil_node_
-					&& substitute != this->ghost_node_) {
-				substitute->parent = node->parent;
-			}
-			if (node->parent) {
-				if (node->parent->left == node) {
-					node->parent->left = substitute;
-				}
-				else {
-					node->parent->right = substitute;
-				}
-			}
-			else {
-				this->root_node_ = substitute;
-			}
-			return;
+			return this->tree_.lower_bound(k);
 		}
 
-		void clear_rbt(rbt_node* node)
+		iterator upper_bound(key_type const& k)
 		{
-			if (node == this->nil_node_ || node == this->ghost_node_) {
-				return;
-			}
-			clear_rbt(node->left);
-			clear_rbt(node->right);
-			this->node_alloc_.destroy(node);
-			this->node_alloc_.deallocate(node, 1);
-			return;
+			return this->tree_.upper_bound(k);
 		}
 
-		iterator find_impl(key_type const& k) const
+		const_iterator upper_bound(key_type const& k) const
 		{
-			rbt_node* node = this->root_node_;
-			while (node != this->nil_node_ && node != this->ghost_node_) {
-				if (this->comp_(k, node->val.first) == true) {
-					node = node->left;
-				}
-				else if (this->comp_(node->val.first, k) == true) {
-					node = node->right;
-				}
-				else {
-					return iterator(node);
-				}
-			}
-			return this->end_impl();
+			return this->tree_.upper_bound(k);
 		}
 
-		iterator lower_bound_impl(key_type const& k) const
+		pair<const_iterator,const_iterator> equal_range(key_type const& k) const
 		{
-			rbt_node* node = this->root_node_;
-			while (node != this->ghost_node_
-					&& this->comp_(node->val.first, k) == true) {
-				node = node->right;
-			}
-			if (node == this->ghost_node_) {
-				return this->end_impl();
-			}
-			while (node->left != this->nil_node_
-						&& node->left != this->ghost_node_
-						&& this->comp_(
-							node->left->get_relative_max()->val.first, k)
-						== false) {
-				node = node->left;
-				while (node != this->nil_node_
-						&& this->comp_(node->val.first, k) == true) {
-					node = node->right;
-				}
-			}
-			return iterator(node);
+			return this->tree_.equal_range_unique(k);
 		}
 
-		iterator upper_bound_impl(key_type const& k) const
+		pair<iterator,iterator> equal_range(key_type const& k)
 		{
-			rbt_node* node = this->root_node_;
-			while (node != this->ghost_node_
-					&& this->comp_(k, node->val.first) == false) {
-				node = node->right;
-			}
-			if (node == this->ghost_node_) {
-				return this->end_impl();
-			}
-			while (node->left != this->nil_node_
-						&& node->left != this->ghost_node_
-						&& this->comp_(k,
-							node->left->get_relative_max()->val.first)
-						== true) {
-				node = node->left;
-				while (node != this->nil_node_
-						&& this->comp_(k, node->val.first) == false) {
-					node = node->right;
-				}
-			}
-			return iterator(node);
+			return this->tree_.equal_range_unique(k);
 		}
 
-		pair<iterator,iterator> equal_range_impl(key_type const& k) const
+		// Calls fn on the elements whose key is in [lo, hi), in order, faster
+		// than an iterator loop over large maps.
+		template <class Function>
+		Function for_each_in_range(key_type const& lo, key_type const& hi,
+				Function fn)
 		{
-			iterator it = this->find_impl(k);
-			if (it != this->end_impl()) {
-				iterator next = it;
-				++next;
-				return pair<iterator, iterator>(it, next);
-			}
-			it = this->upper_bound_impl(k);
-			return pair<iterator, iterator>(it, it);
+			return this->tree_.for_each_in_range(lo, hi, fn);
 		}
 
-		void print_rbt() const
+		template <class Function>
+		Function for_each_in_range(key_type const& lo, key_type const& hi,
+				Function fn) const
 		{
-			std::cout << "size = " << this->size() << std::endl;
-			std::cout << std::endl;
-			if (this->ghost_node_->left != this->ghost_node_) {
-				std::cout << "ghost->left = " << this->ghost_node_->left->val.first << std::endl;
-			}
-			if (this->ghost_node_->right != this->ghost_node_) {
-				std::cout << "ghost->right = " << this->ghost_node_->right->val.first << std::endl;
-			}
-			print_rbt(this->root_node_);
-			return;
+			return this->tree_.for_each_in_range(lo, hi, fn);
 		}
 
-		void print_rbt(rbt_node* node) const
+		allocator_type get_allocator() const
 		{
-			if (node == this->nil_node_ || node == this->ghost_node_) {
-				return;
-			}
-			std::cout << std::endl;
-			if (node->is_red) {
-				std::cout << RED;
-			}
-			std::cout << "val : " << node->val.first << std::endl;
-			std::cout << "parent : ";
-			if (node->parent) {
-				std::cout << node->parent->val.first << std::endl;
-			}
-			else {
-				std::cout << "NIL" << std::endl;
-			}
-			std::cout << "left : ";
-			if (node->left == this->ghost_node_) {
-				std::cout << "GHOST" << std::endl;
-			}
-			else if (node->left != this->nil_node_) {
-				std::cout << node->left->val.first << std::endl;
-			}
-			else {
-				std::cout << "NIL" << std::endl;
-			}
-			std::cout << "right : ";
-			if (node->right == this->ghost_node_) {
-				std::cout << "GHOST" << std::endl;
-			}
-			else if (node->right != this->nil_node_) {
-				std::cout << node->right->val.first << std::endl;
-			}
-			else {
-				std::cout << "NIL" << std::endl;
-			}
-			std::cout << RESET;
-			print_rbt(node->left);
-			print_rbt(node->right);
+			return this->tree_.get_allocator();
 		}
 	};
 
+
 	template< class Key, class T, class Compare, class Alloc >
 	bool operator==(ft::map<Key,T,Compare,Alloc> const& lhs,
 			ft::map<Key,T,Compare,Alloc> const& rhs)
@@ -1196,29 +533,32 @@ namespace ft
 	bool operator<(ft::map<Key,T,Compare,Alloc> const& lhs,
 			ft::map<Key,T,Compare,Alloc> const& rhs)
 	{
-		return ft::lexicographical_compare(lhs.begin(), lhs.end(),
-				rhs.begin(), rhs.end());
+		return ft::lexicographical_compare_three_way(lhs.begin(), lhs.end(),
+				rhs.begin(), rhs.end()) < 0;
 	}
 
 	template< class Key, class T, class Compare, class Alloc >
 	bool operator<=(ft::map<Key,T,Compare,Alloc> const& lhs,
 			ft::map<Key,T,Compare,Alloc> const& rhs)
 	{
-		return !(rhs < lhs);
+		return ft::lexicographical_compare_three_way(lhs.begin(), lhs.end(),
+				rhs.begin(), rhs.end()) <= 0;
 	}
 
 	template< class Key, class T, class Compare, class Alloc >
 	bool operator>(ft::map<Key,T,Compare,Alloc> const& lhs,
 			ft::map<Key,T,Compare,Alloc> const& rhs)
 	{
-		return rhs < lhs;
+		return ft::lexicographical_compare_three_way(lhs.begin(), lhs.end(),
+				rhs.begin(), rhs.end()) > 0;
 	}
 
 	template< class Key, class T, class Compare, class Alloc >
 	bool operator>=(ft::map<Key,T,Compare,Alloc> const& lhs,
 			ft::map<Key,T,Compare,Alloc> const& rhs)
 	{
-		return !(lhs < rhs);
+		return ft::lexicographical_compare_three_way(lhs.begin(), lhs.end(),
+				rhs.begin(), rhs.end()) >= 0;
 	}
 
 	template< class Key, class T, class Compare, class Alloc >
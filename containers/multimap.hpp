@@ -0,0 +1,347 @@
+#ifndef MULTIMAP_HPP
+#define MULTIMAP_HPP
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+#include "comparaison.hpp"
+#include "less.hpp"
+#include "pair.hpp"
+#include "key_of_value.hpp"
+#include "rb_tree.hpp"
+#include "map.hpp"
+
+namespace ft
+{
+	// Sorted associative container allowing equal keys. A new key is linked
+	// after the equal ones, which keep their insertion order.
+	template < class Key, class T, class Compare = ft::less<Key>,
+			 class Alloc = std::allocator< ft::pair<Key const, T> > >
+	class multimap
+	{
+	public:
+		typedef Key key_type;
+		typedef T mapped_type;
+		typedef ft::pair<key_type const, mapped_type> value_type;
+		typedef Compare key_compare;
+		typedef typename ft::map<Key, T, Compare, Alloc>::value_compare
+			value_compare;
+		typedef Alloc allocator_type;
+		typedef typename allocator_type::reference reference;
+		typedef typename allocator_type::const_reference const_reference;
+		typedef typename allocator_type::pointer pointer;
+		typedef typename allocator_type::const_pointer const_pointer;
+
+	protected:
+		typedef ft::rb_tree<key_type, value_type, ft::select_first<value_type>,
+				key_compare, allocator_type> tree_type;
+
+	public:
+		typedef typename tree_type::iterator iterator;
+		typedef typename tree_type::const_iterator const_iterator;
+		typedef typename tree_type::reverse_iterator reverse_iterator;
+		typedef typename tree_type::const_reverse_iterator const_reverse_iterator;
+		typedef typename tree_type::difference_type difference_type;
+		typedef typename tree_type::size_type size_type;
+
+	protected:
+		tree_type tree_;
+
+	public:
+		explicit multimap(key_compare const& comp = key_compare(),
+				allocator_type const& alloc = allocator_type()) :
+			tree_(comp, alloc)
+		{
+			return;
+		}
+
+		template <class InputIterator>
+		multimap(InputIterator first, InputIterator last,
+				key_compare const& comp = key_compare(),
+				allocator_type const& alloc = allocator_type()) :
+			tree_(comp, alloc)
+		{
+			this->insert(first, last);
+			return;
+		}
+
+		multimap(multimap const& x) :
+			tree_(x.tree_)
+		{
+			return;
+		}
+
+		~multimap()
+		{
+			return;
+		}
+
+		multimap& operator=(multimap const& x)
+		{
+			this->tree_ = x.tree_;
+			return *this;
+		}
+
+#if __cplusplus >= 201103L
+		multimap(multimap&& x) :
+			tree_(std::move(x.tree_))
+		{
+			return;
+		}
+
+		multimap& operator=(multimap&& x)
+		{
+			this->tree_ = std::move(x.tree_);
+			return *this;
+		}
+#endif
+
+		iterator begin()
+		{
+			return this->tree_.begin();
+		}
+
+		const_iterator begin() const
+		{
+			return this->tree_.begin();
+		}
+
+		iterator end()
+		{
+			return this->tree_.end();
+		}
+
+		const_iterator end() const
+		{
+			return this->tree_.end();
+		}
+
+		reverse_iterator rbegin()
+		{
+			return this->tree_.rbegin();
+		}
+
+		const_reverse_iterator rbegin() const
+		{
+			return this->tree_.rbegin();
+		}
+
+		reverse_iterator rend()
+		{
+			return this->tree_.rend();
+		}
+
+		const_reverse_iterator rend() const
+		{
+			return this->tree_.rend();
+		}
+
+		bool empty() const
+		{
+			return this->tree_.empty();
+		}
+
+		size_type size() const
+		{
+			return this->tree_.size();
+		}
+
+		size_type max_size() const
+		{
+			return this->tree_.max_size();
+		}
+
+		iterator insert(value_type const& val)
+		{
+			return this->tree_.insert_equal(val);
+		}
+
+		iterator insert(iterator position, value_type const& val)
+		{
+			return this->tree_.insert_equal(position, val);
+		}
+
+		// Sorted input costs amortized constant time per element.
+		template <class InputIterator>
+		void insert(InputIterator first, InputIterator last)
+		{
+			while (first != last) {
+				this->tree_.insert_equal(this->tree_.end(), *first);
+				++first;
+			}
+			return;
+		}
+
+		void erase(iterator position)
+		{
+			this->tree_.erase(position);
+			return;
+		}
+
+		size_type erase(key_type const& k)
+		{
+			return this->tree_.erase_equal(k);
+		}
+
+		void erase(iterator first, iterator last)
+		{
+			this->tree_.erase(first, last);
+			return;
+		}
+
+		void swap(multimap& x)
+		{
+			this->tree_.swap(x.tree_);
+			return;
+		}
+
+		void clear()
+		{
+			this->tree_.clear();
+			return;
+		}
+
+		key_compare key_comp() const
+		{
+			return this->tree_.key_comp();
+		}
+
+		value_compare value_comp() const
+		{
+			return value_compare(this->tree_.key_comp());
+		}
+
+		// The first element of key k.
+		iterator find(key_type const& k)
+		{
+			iterator it = this->lower_bound(k);
+			if (it == this->end() || this->key_comp()(k, it->first) == true) {
+				return this->end();
+			}
+			return it;
+		}
+
+		const_iterator find(key_type const& k) const
+		{
+			const_iterator it = this->lower_bound(k);
+			if (it == this->end() || this->key_comp()(k, it->first) == true) {
+				return this->end();
+			}
+			return it;
+		}
+
+		size_type count(key_type const& k) const
+		{
+			return this->tree_.count(k);
+		}
+
+		iterator lower_bound(key_type const& k)
+		{
+			return this->tree_.lower_bound(k);
+		}
+
+		const_iterator lower_bound(key_type const& k) const
+		{
+			return this->tree_.lower_bound(k);
+		}
+
+		iterator upper_bound(key_type const& k)
+		{
+			return this->tree_.upper_bound(k);
+		}
+
+		const_iterator upper_bound(key_type const& k) const
+		{
+			return this->tree_.upper_bound(k);
+		}
+
+		ft::pair<iterator,iterator> equal_range(key_type const& k)
+		{
+			return this->tree_.equal_range(k);
+		}
+
+		ft::pair<const_iterator,const_iterator> equal_range(key_type const& k)
+			const
+		{
+			return this->tree_.equal_range(k);
+		}
+
+		// Calls fn on the elements whose key is in [lo, hi), in order, faster
+		// than an iterator loop over large multimaps.
+		template <class Function>
+		Function for_each_in_range(key_type const& lo, key_type const& hi,
+				Function fn)
+		{
+			return this->tree_.for_each_in_range(lo, hi, fn);
+		}
+
+		template <class Function>
+		Function for_each_in_range(key_type const& lo, key_type const& hi,
+				Function fn) const
+		{
+			return this->tree_.for_each_in_range(lo, hi, fn);
+		}
+
+		allocator_type get_allocator() const
+		{
+			return this->tree_.get_allocator();
+		}
+	};
+
+	template< class Key, class T, class Compare, class Alloc >
+	bool operator==(ft::multimap<Key,T,Compare,Alloc> const& lhs,
+			ft::multimap<Key,T,Compare,Alloc> const& rhs)
+	{
+		if (lhs.size() != rhs.size()) {
+			return false;
+		}
+		return ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+	}
+
+	template< class Key, class T, class Compare, class Alloc >
+	bool operator!=(ft::multimap<Key,T,Compare,Alloc> const& lhs,
+			ft::multimap<Key,T,Compare,Alloc> const& rhs)
+	{
+		return !(lhs == rhs);
+	}
+
+	template< class Key, class T, class Compare, class Alloc >
+	bool operator<(ft::multimap<Key,T,Compare,Alloc> const& lhs,
+			ft::multimap<Key,T,Compare,Alloc> const& rhs)
+	{
+		return ft::lexicographical_compare(lhs.begin(), lhs.end(),
+				rhs.begin(), rhs.end());
+	}
+
+	template< class Key, class T, class Compare, class Alloc >
+	bool operator<=(ft::multimap<Key,T,Compare,Alloc> const& lhs,
+			ft::multimap<Key,T,Compare,Alloc> const& rhs)
+	{
+		return !(rhs < lhs);
+	}
+
+	template< class Key, class T, class Compare, class Alloc >
+	bool operator>(ft::multimap<Key,T,Compare,Alloc> const& lhs,
+			ft::multimap<Key,T,Compare,Alloc> const& rhs)
+	{
+		return rhs < lhs;
+	}
+
+	template< class Key, class T, class Compare, class Alloc >
+	bool operator>=(ft::multimap<Key,T,Compare,Alloc> const& lhs,
+			ft::multimap<Key,T,Compare,Alloc> const& rhs)
+	{
+		return !(lhs < rhs);
+	}
+
+	template< class Key, class T, class Compare, class Alloc >
+	void swap(ft::multimap<Key,T,Compare,Alloc>& lhs,
+			ft::multimap<Key,T,Compare,Alloc>& rhs)
+	{
+		lhs.swap(rhs);
+		return;
+	}
+}
+
+#endif
@@ -0,0 +1,300 @@
+#ifndef MULTISET_HPP
+#define MULTISET_HPP
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+#include "comparaison.hpp"
+#include "less.hpp"
+#include "pair.hpp"
+#include "key_of_value.hpp"
+#include "rb_tree.hpp"
+
+namespace ft
+{
+	// Sorted associative container allowing equal values. A new value is
+	// linked after the equal ones, which keep their insertion order.
+	template < class T, class Compare = ft::less<T>,
+			 class Alloc = std::allocator<T> >
+	class multiset
+	{
+	public:
+		typedef T key_type;
+		typedef T value_type;
+		typedef Compare key_compare;
+		typedef Compare value_compare;
+		typedef Alloc allocator_type;
+		typedef typename allocator_type::reference reference;
+		typedef typename allocator_type::const_reference const_reference;
+		typedef typename allocator_type::pointer pointer;
+		typedef typename allocator_type::const_pointer const_pointer;
+
+	protected:
+		typedef ft::rb_tree<key_type, value_type, ft::identity<value_type>,
+				key_compare, allocator_type> tree_type;
+
+	public:
+		typedef typename tree_type::const_iterator const_iterator;
+		typedef const_iterator iterator;
+		typedef typename tree_type::const_reverse_iterator const_reverse_iterator;
+		typedef const_reverse_iterator reverse_iterator;
+		typedef typename tree_type::difference_type difference_type;
+		typedef typename tree_type::size_type size_type;
+
+	protected:
+		tree_type tree_;
+
+	public:
+		explicit multiset(key_compare const& comp = key_compare(),
+				allocator_type const& alloc = allocator_type()) :
+			tree_(comp, alloc)
+		{
+			return;
+		}
+
+		template <class InputIterator>
+		multiset(InputIterator first, InputIterator last,
+				key_compare const& comp = key_compare(),
+				allocator_type const& alloc = allocator_type()) :
+			tree_(comp, alloc)
+		{
+			this->insert(first, last);
+			return;
+		}
+
+		multiset(multiset const& x) :
+			tree_(x.tree_)
+		{
+			return;
+		}
+
+		~multiset()
+		{
+			return;
+		}
+
+		multiset& operator=(multiset const& x)
+		{
+			this->tree_ = x.tree_;
+			return *this;
+		}
+
+#if __cplusplus >= 201103L
+		multiset(multiset&& x) :
+			tree_(std::move(x.tree_))
+		{
+			return;
+		}
+
+		multiset& operator=(multiset&& x)
+		{
+			this->tree_ = std::move(x.tree_);
+			return *this;
+		}
+#endif
+
+		iterator begin() const
+		{
+			return this->tree_.begin();
+		}
+
+		iterator end() const
+		{
+			return this->tree_.end();
+		}
+
+		reverse_iterator rbegin() const
+		{
+			return this->tree_.rbegin();
+		}
+
+		reverse_iterator rend() const
+		{
+			return this->tree_.rend();
+		}
+
+		bool empty() const
+		{
+			return this->tree_.empty();
+		}
+
+		size_type size() const
+		{
+			return this->tree_.size();
+		}
+
+		size_type max_size() const
+		{
+			return this->tree_.max_size();
+		}
+
+		iterator insert(value_type const& val)
+		{
+			return this->tree_.insert_equal(val);
+		}
+
+		iterator insert(iterator position, value_type const& val)
+		{
+			return this->tree_.insert_equal(this->to_tree_iterator(position),
+					val);
+		}
+
+		// Sorted input costs amortized constant time per element.
+		template <class InputIterator>
+		void insert(InputIterator first, InputIterator last)
+		{
+			while (first != last) {
+				this->tree_.insert_equal(this->tree_.end(), *first);
+				++first;
+			}
+			return;
+		}
+
+		void erase(iterator position)
+		{
+			this->tree_.erase(this->to_tree_iterator(position));
+			return;
+		}
+
+		size_type erase(value_type const& val)
+		{
+			return this->tree_.erase_equal(val);
+		}
+
+		void erase(iterator first, iterator last)
+		{
+			this->tree_.erase(this->to_tree_iterator(first),
+					this->to_tree_iterator(last));
+			return;
+		}
+
+		void swap(multiset& x)
+		{
+			this->tree_.swap(x.tree_);
+			return;
+		}
+
+		void clear()
+		{
+			this->tree_.clear();
+			return;
+		}
+
+		key_compare key_comp() const
+		{
+			return this->tree_.key_comp();
+		}
+
+		value_compare value_comp() const
+		{
+			return this->tree_.key_comp();
+		}
+
+		// The first element equal to val.
+		iterator find(value_type const& val) const
+		{
+			iterator it = this->lower_bound(val);
+			if (it == this->end() || this->key_comp()(val, *it) == true) {
+				return this->end();
+			}
+			return it;
+		}
+
+		size_type count(value_type const& val) const
+		{
+			return this->tree_.count(val);
+		}
+
+		iterator lower_bound(value_type const& val) const
+		{
+			return this->tree_.lower_bound(val);
+		}
+
+		iterator upper_bound(value_type const& val) const
+		{
+			return this->tree_.upper_bound(val);
+		}
+
+		ft::pair<iterator,iterator> equal_range(value_type const& val) const
+		{
+			return this->tree_.equal_range(val);
+		}
+
+		// Calls fn on the elements in [lo, hi), in order, faster than an
+		// iterator loop over large multisets.
+		template <class Function>
+		Function for_each_in_range(value_type const& lo, value_type const& hi,
+				Function fn) const
+		{
+			return this->tree_.for_each_in_range(lo, hi, fn);
+		}
+
+		allocator_type get_allocator() const
+		{
+			return this->tree_.get_allocator();
+		}
+
+	protected:
+		typename tree_type::iterator to_tree_iterator(iterator it) const
+		{
+			return typename tree_type::iterator(it.ptr_);
+		}
+	};
+
+	template< class T, class Compare, class Alloc >
+	bool operator==(ft::multiset<T,Compare,Alloc> const& lhs,
+			ft::multiset<T,Compare,Alloc> const& rhs)
+	{
+		if (lhs.size() != rhs.size()) {
+			return false;
+		}
+		return ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+	}
+
+	template< class T, class Compare, class Alloc >
+	bool operator!=(ft::multiset<T,Compare,Alloc> const& lhs,
+			ft::multiset<T,Compare,Alloc> const& rhs)
+	{
+		return !(lhs == rhs);
+	}
+
+	template< class T, class Compare, class Alloc >
+	bool operator<(ft::multiset<T,Compare,Alloc> const& lhs,
+			ft::multiset<T,Compare,Alloc> const& rhs)
+	{
+		return ft::lexicographical_compare(lhs.begin(), lhs.end(),
+				rhs.begin(), rhs.end());
+	}
+
+	template< class T, class Compare, class Alloc >
+	bool operator<=(ft::multiset<T,Compare,Alloc> const& lhs,
+			ft::multiset<T,Compare,Alloc> const& rhs)
+	{
+		return !(rhs < lhs);
+	}
+
+	template< class T, class Compare, class Alloc >
+	bool operator>(ft::multiset<T,Compare,Alloc> const& lhs,
+			ft::multiset<T,Compare,Alloc> const& rhs)
+	{
+		return rhs < lhs;
+	}
+
+	template< class T, class Compare, class Alloc >
+	bool operator>=(ft::multiset<T,Compare,Alloc> const& lhs,
+			ft::multiset<T,Compare,Alloc> const& rhs)
+	{
+		return !(lhs < rhs);
+	}
+
+	template< class T, class Compare, class Alloc >
+	void swap(ft::multiset<T,Compare,Alloc>& lhs,
+			ft::multiset<T,Compare,Alloc>& rhs)
+	{
+		lhs.swap(rhs);
+		return;
+	}
+}
+
+#endif
@@ -1,6 +1,10 @@
 #ifndef PAIR_HPP
 #define PAIR_HPP
 
+#include <utility>
+
+#include "type_traits.hpp"
+
 namespace ft
 {
 	template <class T1, class T2>
@@ -34,11 +38,34 @@ namespace ft
 			return;
 		}
 
-		~pair()
+#if __cplusplus >= 201103L
+		pair(pair const& pr) :
+			first(pr.first),
+			second(pr.second)
+		{
+			return;
+		}
+
+		pair(pair&& pr) :
+			first(std::move(pr.first)),
+			second(std::move(pr.second))
+		{
+			return;
+		}
+
+		template <class U, class V>
+		pair(U&& a, V&& b) :
+			first(std::forward<U>(a)),
+			second(std::forward<V>(b))
 		{
 			return;
 		}
+#endif
 
+		~pair()
+		{
+			return;
+		}
 
 		pair& operator=(pair const& pr)
 		{
@@ -46,6 +73,15 @@ namespace ft
 			this->second = pr.second;
 			return *this;
 		}
+
+#if __cplusplus >= 201103L
+		pair& operator=(pair&& pr)
+		{
+			this->first = std::move(pr.first);
+			this->second = std::move(pr.second);
+			return *this;
+		}
+#endif
 	};
 
 	template <class T1, class T2>
@@ -89,6 +125,21 @@ namespace ft
 	{
 		return pair<T1,T2>(x,y);
 	}
+
+	// Its copy operations and destructor only act on both members.
+	template <class T1, class T2>
+	struct is_bitwise_copyable< ft::pair<T1,T2> >
+	{
+		static bool const value = ft::is_bitwise_copyable<T1>::value
+			&& ft::is_bitwise_copyable<T2>::value;
+	};
+
+	template <class T1, class T2>
+	struct is_trivially_destructible< ft::pair<T1,T2> >
+	{
+		static bool const value = ft::is_trivially_destructible<T1>::value
+			&& ft::is_trivially_destructible<T2>::value;
+	};
 }
 
 #endif
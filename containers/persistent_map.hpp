@@ -0,0 +1,862 @@
+#ifndef PERSISTENT_MAP_HPP
+#define PERSISTENT_MAP_HPP
+
+#include <climits>
+#include <iterator>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+
+#include "reverse_iterator.hpp"
+#include "iterator_traits.hpp"
+#include "comparaison.hpp"
+
+#include "less.hpp"
+#include "pair.hpp"
+#include "persistent_node.hpp"
+
+namespace ft
+{
+	// Red-black tree map whose nodes are reference counted and shared
+	// between copies, so that copying and snapshot() are O(1). A write copies
+	// the nodes of its root to leaf path that are still shared and modifies
+	// the ones it owns alone in place.
+	//
+	// Values are only reachable through const iterators, which stay valid
+	// until the map they come from is written to. A snapshot can be read from
+	// another thread while the map it was taken from keeps being written to,
+	// taking it has to be ordered with the writes though.
+	template < class Key, class T, class Compare = ft::less<Key>,
+			 class Alloc = std::allocator< ft::pair<Key const, T> > >
+	class persistent_map
+	{
+	public:
+		typedef Key key_type;
+		typedef T mapped_type;
+		typedef ft::pair<key_type const, mapped_type> value_type;
+		typedef Compare key_compare;
+		class value_compare;
+		typedef Alloc allocator_type;
+		typedef typename allocator_type::reference reference;
+		typedef typename allocator_type::const_reference const_reference;
+		typedef typename allocator_type::pointer pointer;
+		typedef typename allocator_type::const_pointer const_pointer;
+		class const_iterator;
+		typedef const_iterator iterator;
+		typedef ft::reverse_iterator<const_iterator> const_reverse_iterator;
+		typedef const_reverse_iterator reverse_iterator;
+
+	protected:
+		typedef persistent_node<value_type> node;
+		typedef typename allocator_type::template rebind<node>::other
+			node_allocator_type;
+
+		// a red-black tree of n nodes is at most 2 * log2(n + 1) high
+		enum { max_height = 2 * sizeof(std::size_t) * CHAR_BIT + 2 };
+
+	public:
+		typedef std::ptrdiff_t difference_type;
+		typedef std::size_t size_type;
+
+		class value_compare
+		{
+		protected:
+			Compare comp_;
+
+		public:
+			typedef bool result_type;
+			typedef value_type first_argument_type;
+			typedef value_type second_argument_type;
+
+			value_compare(Compare c) :
+				comp_(c)
+			{
+				return;
+			}
+
+			bool operator()(value_type const& x, value_type const& y) const
+			{
+				return this->comp_(x.first, y.first);
+			}
+		};
+
+		// Without parent links the iterator keeps the root it was taken
+		// from, going up is a search from it.
+		class const_iterator : std::bidirectional_iterator_tag
+		{
+		public:
+			typedef typename ft::iterator_traits<const_pointer>::value_type value_type;
+			typedef typename ft::iterator_traits<const_pointer>::difference_type difference_type;
+			typedef const_pointer pointer;
+			typedef typename ft::iterator_traits<const_pointer>::reference reference;
+			typedef std::bidirectional_iterator_tag iterator_category;
+
+			node const* root_;
+			node const* ptr_;
+			key_compare comp_;
+
+			const_iterator() :
+				root_(NULL),
+				ptr_(NULL),
+				comp_()
+			{
+				return;
+			}
+
+			const_iterator(node const* root, node const* ptr,
+					key_compare const& comp) :
+				root_(root),
+				ptr_(ptr),
+				comp_(comp)
+			{
+				return;
+			}
+
+			const_iterator(const_iterator const& src) :
+				root_(src.root_),
+				ptr_(src.ptr_),
+				comp_(src.comp_)
+			{
+				return;
+			}
+
+			virtual ~const_iterator()
+			{
+				return;
+			}
+
+			const_iterator& operator=(const_iterator const& rhs)
+			{
+				this->root_ = rhs.root_;
+				this->ptr_ = rhs.ptr_;
+				this->comp_ = rhs.comp_;
+				return *this;
+			}
+
+			bool operator==(const_iterator const& rhs) const
+			{
+				return this->ptr_ == rhs.ptr_;
+			}
+
+			bool operator!=(const_iterator const& rhs) const
+			{
+				return this->ptr_ != rhs.ptr_;
+			}
+
+			reference operator*() const
+			{
+				return this->ptr_->val;
+			}
+
+			pointer operator->() const
+			{
+				return &this->ptr_->val;
+			}
+
+			const_iterator& operator++()
+			{
+				if (this->ptr_->right != NULL) {
+					this->ptr_ = this->ptr_->right;
+					while (this->ptr_->left != NULL) {
+						this->ptr_ = this->ptr_->left;
+					}
+					return *this;
+				}
+				node const* next = NULL;
+				node const* current = this->root_;
+				while (current != this->ptr_) {
+					if (this->comp_(this->ptr_->val.first, current->val.first)
+							== true) {
+						next = current;
+						current = current->left;
+					}
+					else {
+						current = current->right;
+					}
+				}
+				this->ptr_ = next;
+				return *this;
+			}
+
+			const_iterator operator++(int)
+			{
+				const_iterator tmp = *this;
+				++(*this);
+				return tmp;
+			}
+
+			const_iterator& operator--()
+			{
+				if (this->ptr_ == NULL) {
+					this->ptr_ = this->root_;
+					while (this->ptr_->right != NULL) {
+						this->ptr_ = this->ptr_->right;
+					}
+					return *this;
+				}
+				if (this->ptr_->left != NULL) {
+					this->ptr_ = this->ptr_->left;
+					while (this->ptr_->right != NULL) {
+						this->ptr_ = this->ptr_->right;
+					}
+					return *this;
+				}
+				node const* previous = NULL;
+				node const* current = this->root_;
+				while (current != this->ptr_) {
+					if (this->comp_(current->val.first, this->ptr_->val.first)
+							== true) {
+						previous = current;
+						current = current->right;
+					}
+					else {
+						current = current->left;
+					}
+				}
+				this->ptr_ = previous;
+				return *this;
+			}
+
+			const_iterator operator--(int)
+			{
+				const_iterator tmp = *this;
+				--(*this);
+				return tmp;
+			}
+		};
+
+	protected:
+		key_compare comp_;
+		allocator_type alloc_;
+		node_allocator_type node_alloc_;
+		node* root_;
+		size_type size_;
+
+	public:
+		explicit persistent_map(key_compare const& comp = key_compare(),
+				allocator_type const& alloc = allocator_type()) :
+			comp_(comp),
+			alloc_(alloc),
+			node_alloc_(),
+			root_(NULL),
+			size_(0)
+		{
+			return;
+		}
+
+		template <class InputIterator>
+		persistent_map(InputIterator first, InputIterator last,
+				key_compare const& comp = key_compare(),
+				allocator_type const& alloc = allocator_type()) :
+			comp_(comp),
+			alloc_(alloc),
+			node_alloc_(),
+			root_(NULL),
+			size_(0)
+		{
+			this->insert(first, last);
+			return;
+		}
+
+		persistent_map(persistent_map const& x) :
+			comp_(x.comp_),
+			alloc_(x.alloc_),
+			node_alloc_(x.node_alloc_),
+			root_(node::acquire(x.root_)),
+			size_(x.size_)
+		{
+			return;
+		}
+
+		~persistent_map()
+		{
+			this->release(this->root_);
+			return;
+		}
+
+		persistent_map& operator=(persistent_map const& x)
+		{
+			node* root = node::acquire(x.root_);
+			this->release(this->root_);
+			this->root_ = root;
+			this->size_ = x.size_;
+			this->comp_ = x.comp_;
+			return *this;
+		}
+
+#if __cplusplus >= 201103L
+		persistent_map(persistent_map&& x) :
+			comp_(x.comp_),
+			alloc_(x.alloc_),
+			node_alloc_(x.node_alloc_),
+			root_(x.root_),
+			size_(x.size_)
+		{
+			x.root_ = NULL;
+			x.size_ = 0;
+			return;
+		}
+
+		persistent_map& operator=(persistent_map&& x)
+		{
+			if (this != &x) {
+				this->release(this->root_);
+				this->root_ = x.root_;
+				this->size_ = x.size_;
+				this->comp_ = x.comp_;
+				x.root_ = NULL;
+				x.size_ = 0;
+			}
+			return *this;
+		}
+#endif
+
+		// O(1), the returned map shares every node with this one.
+		persistent_map snapshot() const
+		{
+			return *this;
+		}
+
+		const_iterator begin() const
+		{
+			node const* min = this->root_;
+			if (min != NULL) {
+				while (min->left != NULL) {
+					min = min->left;
+				}
+			}
+			return const_iterator(this->root_, min, this->comp_);
+		}
+
+		const_iterator end() const
+		{
+			return const_iterator(this->root_, NULL, this->comp_);
+		}
+
+		const_reverse_iterator rbegin() const
+		{
+			return const_reverse_iterator(this->end());
+		}
+
+		const_reverse_iterator rend() const
+		{
+			return const_reverse_iterator(this->begin());
+		}
+
+		bool empty() const
+		{
+			return this->size_ == 0;
+		}
+
+		size_type size() const
+		{
+			return this->size_;
+		}
+
+		size_type max_size() const
+		{
+			return this->node_alloc_.max_size();
+		}
+
+		ft::pair<const_iterator, bool> insert(value_type const& val)
+		{
+			node* found = this->find_node(val.first);
+			if (found != NULL) {
+				return ft::make_pair(const_iterator(this->root_, found,
+							this->comp_), false);
+			}
+			node* path[max_height];
+			size_type depth = 0;
+			node** slot = &this->root_;
+			while (*slot != NULL) {
+				this->make_unique(*slot);
+				path[depth++] = *slot;
+				if (this->comp_(val.first, (*slot)->val.first) == true) {
+					slot = &(*slot)->left;
+				}
+				else {
+					slot = &(*slot)->right;
+				}
+			}
+			node* new_node = this->create_node(val, NULL, NULL, true);
+			*slot = new_node;
+			path[depth++] = new_node;
+			this->size_++;
+			this->fix_insertion(path, depth);
+			return ft::make_pair(const_iterator(this->root_, new_node,
+						this->comp_), true);
+		}
+
+		const_iterator insert(const_iterator position, value_type const& val)
+		{
+			static_cast<void>(position);
+			return this->insert(val).first;
+		}
+
+		template <class InputIterator>
+		void insert(InputIterator first, InputIterator last)
+		{
+			while (first != last) {
+				this->insert(*first);
+				++first;
+			}
+			return;
+		}
+
+		// Inserts the value or replaces the mapped value of its key, returns
+		// whether it was inserted.
+		bool insert_or_assign(value_type const& val)
+		{
+			if (this->find_node(val.first) == NULL) {
+				this->insert(val);
+				return true;
+			}
+			node** slot = &this->root_;
+			while (true) {
+				this->make_unique(*slot);
+				node* current = *slot;
+				if (this->comp_(val.first, current->val.first) == true) {
+					slot = &current->left;
+				}
+				else if (this->comp_(current->val.first, val.first) == true) {
+					slot = &current->right;
+				}
+				else {
+					current->val.second = val.second;
+					return false;
+				}
+			}
+		}
+
+		size_type erase(key_type const& k)
+		{
+			if (this->find_node(k) == NULL) {
+				return 0;
+			}
+			node* path[max_height];
+			size_type depth = 0;
+			node** slot = &this->root_;
+			while (true) {
+				this->make_unique(*slot);
+				node* current = *slot;
+				path[depth++] = current;
+				if (this->comp_(k, current->val.first) == true) {
+					slot = &current->left;
+				}
+				else if (this->comp_(current->val.first, k) == true) {
+					slot = &current->right;
+				}
+				else {
+					break;
+				}
+			}
+			size_type index = depth - 1;
+			node* erased = path[index];
+			node* child;
+			bool removed_red;
+			if (erased->left != NULL && erased->right != NULL) {
+				slot = &erased->right;
+				while (true) {
+					this->make_unique(*slot);
+					path[depth++] = *slot;
+					if ((*slot)->left == NULL) {
+						break;
+					}
+					slot = &(*slot)->left;
+				}
+				node* successor = path[depth - 1];
+				child = successor->right;
+				removed_red = successor->red;
+				*slot = child;
+				successor->left = erased->left;
+				successor->right = erased->right;
+				successor->red = erased->red;
+				this->child_slot(path, index) = successor;
+				path[index] = successor;
+			}
+			else {
+				child = erased->left != NULL ? erased->left : erased->right;
+				removed_red = erased->red;
+				this->child_slot(path, index) = child;
+			}
+			depth--;
+			this->destroy_node(erased);
+			this->size_--;
+			if (removed_red == false) {
+				this->fix_deletion(path, depth, child);
+			}
+			return 1;
+		}
+
+		void erase(const_iterator position)
+		{
+			this->erase(position->first);
+			return;
+		}
+
+		void swap(persistent_map& x)
+		{
+			key_compare tmp_comp = this->comp_;
+			this->comp_ = x.comp_;
+			x.comp_ = tmp_comp;
+			node* tmp_root = this->root_;
+			this->root_ = x.root_;
+			x.root_ = tmp_root;
+			size_type tmp_size = this->size_;
+			this->size_ = x.size_;
+			x.size_ = tmp_size;
+			return;
+		}
+
+		void clear()
+		{
+			this->release(this->root_);
+			this->root_ = NULL;
+			this->size_ = 0;
+			return;
+		}
+
+		key_compare key_comp() const
+		{
+			return this->comp_;
+		}
+
+		value_compare value_comp() const
+		{
+			return value_compare(this->comp_);
+		}
+
+		const_iterator find(key_type const& k) const
+		{
+			return const_iterator(this->root_, this->find_node(k), this->comp_);
+		}
+
+		size_type count(key_type const& k) const
+		{
+			return this->find_node(k) != NULL;
+		}
+
+		const_iterator lower_bound(key_type const& k) const
+		{
+			node* bound = NULL;
+			node* current = this->root_;
+			while (current != NULL) {
+				if (this->comp_(current->val.first, k) == true) {
+					current = current->right;
+				}
+				else {
+					bound = current;
+					current = current->left;
+				}
+			}
+			return const_iterator(this->root_, bound, this->comp_);
+		}
+
+		const_iterator upper_bound(key_type const& k) const
+		{
+			node* bound = NULL;
+			node* current = this->root_;
+			while (current != NULL) {
+				if (this->comp_(k, current->val.first) == true) {
+					bound = current;
+					current = current->left;
+				}
+				else {
+					current = current->right;
+				}
+			}
+			return const_iterator(this->root_, bound, this->comp_);
+		}
+
+		ft::pair<const_iterator, const_iterator> equal_range(key_type const& k)
+			const
+		{
+			return ft::make_pair(this->lower_bound(k), this->upper_bound(k));
+		}
+
+		allocator_type get_allocator() const
+		{
+			return this->alloc_;
+		}
+
+	protected:
+		node* find_node(key_type const& k) const
+		{
+			node* current = this->root_;
+			while (current != NULL) {
+				if (this->comp_(k, current->val.first) == true) {
+					current = current->left;
+				}
+				else if (this->comp_(current->val.first, k) == true) {
+					current = current->right;
+				}
+				else {
+					return current;
+				}
+			}
+			return NULL;
+		}
+
+		node* create_node(value_type const& val, node* left, node* right,
+				bool red)
+		{
+			node* new_node = this->node_alloc_.allocate(1);
+			try {
+				new (new_node) node(val, left, right, red);
+			}
+			catch (...) {
+				this->node_alloc_.deallocate(new_node, 1);
+				throw;
+			}
+			return new_node;
+		}
+
+		void destroy_node(node* old_node)
+		{
+			this->node_alloc_.destroy(old_node);
+			this->node_alloc_.deallocate(old_node, 1);
+			return;
+		}
+
+		// Drops a reference to the subtree, freeing the nodes nothing else
+		// references anymore.
+		void release(node* subtree)
+		{
+			while (subtree != NULL && node::drop(subtree) == true) {
+				this->release(subtree->left);
+				node* right = subtree->right;
+				this->destroy_node(subtree);
+				subtree = right;
+			}
+			return;
+		}
+
+		// Replaces a node still shared with another version by a copy owned
+		// by this tree, its children becoming shared with the copy.
+		void make_unique(node*& slot)
+		{
+			if (slot->is_shared() == false) {
+				return;
+			}
+			node* shared = slot;
+			slot = this->create_node(shared->val, node::acquire(shared->left),
+					node::acquire(shared->right), shared->red);
+			this->release(shared);
+			return;
+		}
+
+		// Pointer to path[i] in its parent, path[i - 1], or the root.
+		node*& child_slot(node** path, size_type i)
+		{
+			if (i == 0) {
+				return this->root_;
+			}
+			if (path[i - 1]->left == path[i]) {
+				return path[i - 1]->left;
+			}
+			return path[i - 1]->right;
+		}
+
+		static void rotate_left(node*& slot)
+		{
+			node* top = slot;
+			node* right = top->right;
+			top->right = right->left;
+			right->left = top;
+			slot = right;
+			return;
+		}
+
+		static void rotate_right(node*& slot)
+		{
+			node* top = slot;
+			node* left = top->left;
+			top->left = left->right;
+			left->right = top;
+			slot = left;
+			return;
+		}
+
+		// Every node of the path is owned by this tree, the path ends with
+		// the inserted node.
+		void fix_insertion(node** path, size_type depth)
+		{
+			size_type i = depth - 1;
+			while (i > 1 && path[i - 1]->red == true) {
+				node* parent = path[i - 1];
+				node* grand_parent = path[i - 2];
+				node*& uncle = grand_parent->left == parent
+					? grand_parent->right : grand_parent->left;
+				if (node::is_red(uncle) == true) {
+					this->make_unique(uncle);
+					uncle->red = false;
+					parent->red = false;
+					grand_parent->red = true;
+					i -= 2;
+					continue;
+				}
+				if (grand_parent->left == parent) {
+					if (parent->right == path[i]) {
+						rotate_left(grand_parent->left);
+						parent = path[i];
+					}
+					rotate_right(this->child_slot(path, i - 2));
+				}
+				else {
+					if (parent->left == path[i]) {
+						rotate_right(grand_parent->right);
+						parent = path[i];
+					}
+					rotate_left(this->child_slot(path, i - 2));
+				}
+				parent->red = false;
+				grand_parent->red = true;
+				break;
+			}
+			this->root_->red = false;
+			return;
+		}
+
+		// child took the place of a removed black node, under path[depth - 1]
+		// or at the root. Every node of the path is owned by this tree.
+		void fix_deletion(node** path, size_type depth, node* child)
+		{
+			size_type i = depth;
+			while (i > 0 && node::is_red(child) == false) {
+				node* parent = path[i - 1];
+				if (parent->left == child) {
+					this->make_unique(parent->right);
+					node* sibling = parent->right;
+					if (sibling->red == true) {
+						sibling->red = false;
+						parent->red = true;
+						rotate_left(this->child_slot(path, i - 1));
+						path[i - 1] = sibling;
+						path[i] = parent;
+						i++;
+						this->make_unique(parent->right);
+						sibling = parent->right;
+					}
+					if (node::is_red(sibling->left) == false
+							&& node::is_red(sibling->right) == false) {
+						sibling->red = true;
+						child = parent;
+						i--;
+						continue;
+					}
+					if (node::is_red(sibling->right) == false) {
+						this->make_unique(sibling->left);
+						sibling->left->red = false;
+						sibling->red = true;
+						rotate_right(parent->right);
+						sibling = parent->right;
+					}
+					this->make_unique(sibling->right);
+					sibling->red = parent->red;
+					parent->red = false;
+					sibling->right->red = false;
+					rotate_left(this->child_slot(path, i - 1));
+				}
+				else {
+					this->make_unique(parent->left);
+					node* sibling = parent->left;
+					if (sibling->red == true) {
+						sibling->red = false;
+						parent->red = true;
+						rotate_right(this->child_slot(path, i - 1));
+						path[i - 1] = sibling;
+						path[i] = parent;
+						i++;
+						this->make_unique(parent->left);
+						sibling = parent->left;
+					}
+					if (node::is_red(sibling->left) == false
+							&& node::is_red(sibling->right) == false) {
+						sibling->red = true;
+						child = parent;
+						i--;
+						continue;
+					}
+					if (node::is_red(sibling->left) == false) {
+						this->make_unique(sibling->right);
+						sibling->right->red = false;
+						sibling->red = true;
+						rotate_left(parent->left);
+						sibling = parent->left;
+					}
+					this->make_unique(sibling->left);
+					sibling->red = parent->red;
+					parent->red = false;
+					sibling->left->red = false;
+					rotate_right(this->child_slot(path, i - 1));
+				}
+				return;
+			}
+			if (node::is_red(child) == true) {
+				node*& slot = i == 0 ? this->root_
+					: path[i - 1]->left == child ? path[i - 1]->left
+					: path[i - 1]->right;
+				this->make_unique(slot);
+				slot->red = false;
+			}
+			return;
+		}
+	};
+
+	template< class Key, class T, class Compare, class Alloc >
+	bool operator==(ft::persistent_map<Key,T,Compare,Alloc> const& lhs,
+			ft::persistent_map<Key,T,Compare,Alloc> const& rhs)
+	{
+		if (lhs.size() != rhs.size()) {
+			return false;
+		}
+		return ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+	}
+
+	template< class Key, class T, class Compare, class Alloc >
+	bool operator!=(ft::persistent_map<Key,T,Compare,Alloc> const& lhs,
+			ft::persistent_map<Key,T,Compare,Alloc> const& rhs)
+	{
+		return !(lhs == rhs);
+	}
+
+	template< class Key, class T, class Compare, class Alloc >
+	bool operator<(ft::persistent_map<Key,T,Compare,Alloc> const& lhs,
+			ft::persistent_map<Key,T,Compare,Alloc> const& rhs)
+	{
+		return ft::lexicographical_compare(lhs.begin(), lhs.end(),
+				rhs.begin(), rhs.end());
+	}
+
+	template< class Key, class T, class Compare, class Alloc >
+	bool operator<=(ft::persistent_map<Key,T,Compare,Alloc> const& lhs,
+			ft::persistent_map<Key,T,Compare,Alloc> const& rhs)
+	{
+		return !(rhs < lhs);
+	}
+
+	template< class Key, class T, class Compare, class Alloc >
+	bool operator>(ft::persistent_map<Key,T,Compare,Alloc> const& lhs,
+			ft::persistent_map<Key,T,Compare,Alloc> const& rhs)
+	{
+		return rhs < lhs;
+	}
+
+	template< class Key, class T, class Compare, class Alloc >
+	bool operator>=(ft::persistent_map<Key,T,Compare,Alloc> const& lhs,
+			ft::persistent_map<Key,T,Compare,Alloc> const& rhs)
+	{
+		return !(lhs < rhs);
+	}
+
+	template< class Key, class T, class Compare, class Alloc >
+	void swap(ft::persistent_map<Key,T,Compare,Alloc>& lhs,
+			ft::persistent_map<Key,T,Compare,Alloc>& rhs)
+	{
+		lhs.swap(rhs);
+		return;
+	}
+}
+
+#endif
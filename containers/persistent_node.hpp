@@ -0,0 +1,71 @@
+#ifndef PERSISTENT_NODE_HPP
+#define PERSISTENT_NODE_HPP
+
+#include <cstdlib>
+
+namespace ft
+{
+	// Red-black node shared between the versions of a persistent tree. There
+	// is no parent link, a node being possibly reachable from several
+	// parents, and it lives as long as one of them references it.
+	template <class ValueType>
+	class persistent_node
+	{
+	public:
+		ValueType val;
+		persistent_node* left;
+		persistent_node* right;
+		long refs;
+		bool red;
+
+		persistent_node(ValueType const& v, persistent_node* l,
+				persistent_node* r, bool is_red) :
+			val(v),
+			left(l),
+			right(r),
+			refs(1),
+			red(is_red)
+		{
+			return;
+		}
+
+		~persistent_node()
+		{
+			return;
+		}
+
+		// A node is only written to while its sole owner is the tree being
+		// modified, other trees keep seeing their own version. The acquire
+		// load orders the reads of a version released on another thread
+		// before the writes of the owner.
+		bool is_shared() const
+		{
+			return __atomic_load_n(&this->refs, __ATOMIC_ACQUIRE) != 1;
+		}
+
+		static persistent_node* acquire(persistent_node* node)
+		{
+			if (node != NULL) {
+				__atomic_add_fetch(&node->refs, 1, __ATOMIC_ACQ_REL);
+			}
+			return node;
+		}
+
+		// Returns whether the caller dropped the last reference.
+		static bool drop(persistent_node* node)
+		{
+			return __atomic_sub_fetch(&node->refs, 1, __ATOMIC_ACQ_REL) == 0;
+		}
+
+		static bool is_red(persistent_node const* node)
+		{
+			return node != NULL && node->red == true;
+		}
+
+	private:
+		persistent_node(persistent_node const& src);
+		persistent_node& operator=(persistent_node const& rhs);
+	};
+}
+
+#endif
@@ -0,0 +1,2118 @@
+#ifndef RB_TREE_HPP
+#define RB_TREE_HPP
+
+#define RESET   "\033[0m"
+#define RED     "\033[31m"
+
+#include <iostream>
+
+#include <climits>
+#include <iterator>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+#if __cplusplus >= 201103L
+# include <type_traits>
+#endif
+
+#include "reverse_iterator.hpp"
+#include "iterator_traits.hpp"
+#include "type_traits.hpp"
+
+#include "pair.hpp"
+#include "rbt_node.hpp"
+
+namespace ft
+{
+	// Whether an argument A1 is the key of the Value it builds with a second
+	// argument, true of a map value built from its key and mapped value.
+	template <class Key, class Value, class A1>
+	struct is_key_argument
+	{
+		static bool const value = false;
+	};
+
+	template <class Key, class T>
+	struct is_key_argument<Key, ft::pair<Key const, T>, Key>
+	{
+		static bool const value = true;
+	};
+
+	// Node update of the trees without augmented data, compiled out.
+	struct rbt_no_update
+	{
+		enum { enabled = 0 };
+
+		template <class Value>
+		void operator()(Value&, Value const*, Value const*) const
+		{
+			return;
+		}
+	};
+
+	// Red-black tree shared by map, set, multimap and multiset. The *_unique
+	// members keep the keys distinct, the *_equal ones link a key after its
+	// equal ones. Nodes never move, so iterators stay valid until their
+	// element is erased.
+	// NodeUpdate recomputes the data a node keeps about its subtree from its
+	// children ones, NULL for leaves. It is kept up to date by the insertions
+	// and erasures but not by split, join and erase_unique of a range.
+	template <class Key, class Value, class KeyOfValue, class Compare,
+			 class Alloc, class NodeUpdate = ft::rbt_no_update>
+	class rb_tree
+	{
+	public:
+		typedef Key key_type;
+		typedef Value value_type;
+		typedef Compare key_compare;
+		typedef Alloc allocator_type;
+		typedef typename allocator_type::reference reference;
+		typedef typename allocator_type::const_reference const_reference;
+		typedef typename allocator_type::pointer pointer;
+		typedef typename allocator_type::const_pointer const_pointer;
+		class iterator;
+		class const_iterator;
+		typedef ft::reverse_iterator<iterator> reverse_iterator;
+		typedef ft::reverse_iterator<const_iterator> const_reverse_iterator;
+		typedef rbt_node<value_type> rbt_node;
+		typedef typename allocator_type::template rebind<rbt_node>::other
+			node_allocator_type;
+		typedef typename ft::iterator_traits<iterator>::difference_type difference_type;
+		typedef std::size_t size_type;
+
+		class iterator : std::bidirectional_iterator_tag
+		{
+		public:
+			typedef typename ft::iterator_traits<pointer>::value_type value_type;
+			typedef typename ft::iterator_traits<pointer>::difference_type difference_type;
+			typedef pointer pointer;
+			typedef typename ft::iterator_traits<pointer>::reference reference;
+			typedef std::bidirectional_iterator_tag iterator_category;
+
+			rbt_node* ptr_;
+
+			iterator() :
+				ptr_(NULL)
+			{
+				return;
+			}
+
+			iterator(rbt_node* ptr) :
+				ptr_(ptr)
+			{
+				return;
+			}
+
+			iterator(iterator const& src) :
+				ptr_(src.ptr_)
+			{
+				return;
+			}
+
+			virtual ~iterator()
+			{
+				return;
+			}
+
+			iterator& operator=(iterator const& rhs)
+			{
+				this->ptr_ = rhs.ptr_;
+				return *this;
+			}
+
+			bool operator==(const_iterator const& rhs) const
+			{
+				return this->ptr_ == rhs.ptr_;
+			}
+
+			bool operator!=(const_iterator const& rhs) const
+			{
+				return this->ptr_ != rhs.ptr_;
+			}
+
+			reference operator*() const
+			{
+				return this->ptr_->val;
+			}
+
+			pointer operator->() const
+			{
+				return &this->ptr_->val;
+			}
+
+			iterator& operator++()
+			{
+				if (this->ptr_->right->right) {
+					this->ptr_ = this->ptr_->right;
+					if (this->ptr_->left->right != this->ptr_) {
+						while (this->ptr_->left->left) {
+							this->ptr_ = this->ptr_->left;
+						}
+					}
+				}
+				else {
+					rbt_node* parent = this->ptr_->get_parent();
+					while (parent->left != this->ptr_) {
+						this->ptr_ = parent;
+						parent = this->ptr_->get_parent();
+					}
+					this->ptr_ = parent;
+				}
+				return *this;
+			}
+
+			iterator operator++(int)
+			{
+				iterator tmp = *this;
+				++(*this);
+				return tmp;
+			}
+
+			iterator& operator--()
+			{
+				if (this->ptr_->left->left) {
+					this->ptr_ = this->ptr_->left;
+					if (this->ptr_->right->left != this->ptr_) {
+						while (this->ptr_->right->right) {
+							this->ptr_ = this->ptr_->right;
+						}
+					}
+				}
+				else {
+					rbt_node* parent = this->ptr_->get_parent();
+					while (parent->right != this->ptr_) {
+						this->ptr_ = parent;
+						parent = this->ptr_->get_parent();
+					}
+					this->ptr_ = parent;
+				}
+				return *this;
+			}
+
+			iterator operator--(int)
+			{
+				iterator tmp = *this;
+				--(*this);
+				return tmp;
+			}
+		};
+
+		class const_iterator : std::bidirectional_iterator_tag
+		{
+		public:
+			typedef typename ft::iterator_traits<const_pointer>::value_type value_type;
+			typedef typename ft::iterator_traits<const_pointer>::difference_type difference_type;
+			typedef const_pointer pointer;
+			typedef typename ft::iterator_traits<const_pointer>::reference reference;
+			typedef std::bidirectional_iterator_tag iterator_category;
+
+			rbt_node* ptr_;
+
+			const_iterator() :
+				ptr_(NULL)
+			{
+				return;
+			}
+
+			const_iterator(rbt_node* ptr) :
+				ptr_(ptr)
+			{
+				return;
+			}
+
+			const_iterator(iterator const& src) :
+				ptr_(src.ptr_)
+			{
+				return;
+			}
+
+			const_iterator(const_iterator const& src) :
+				ptr_(src.ptr_)
+			{
+				return;
+			}
+
+			virtual ~const_iterator()
+			{
+				return;
+			}
+
+			const_iterator& operator=(iterator const& rhs)
+			{
+				this->ptr_ = rhs.ptr_;
+				return *this;
+			}
+
+
+			const_iterator& operator=(const_iterator const& rhs)
+			{
+				this->ptr_ = rhs.ptr_;
+				return *this;
+			}
+
+			bool operator==(const_iterator const& rhs) const
+			{
+				return this->ptr_ == rhs.ptr_;
+			}
+
+			bool operator!=(const_iterator const& rhs) const
+			{
+				return this->ptr_ != rhs.ptr_;
+			}
+
+			reference operator*() const
+			{
+				return this->ptr_->val;
+			}
+
+			pointer operator->() const
+			{
+				return &this->ptr_->val;
+			}
+
+			const_iterator& operator++()
+			{
+				if (this->ptr_->right->right) {
+					this->ptr_ = this->ptr_->right;
+					if (this->ptr_->left->right != this->ptr_) {
+						while (this->ptr_->left->left) {
+							this->ptr_ = this->ptr_->left;
+						}
+					}
+				}
+				else {
+					rbt_node* parent = this->ptr_->get_parent();
+					while (parent->left != this->ptr_) {
+						this->ptr_ = parent;
+						parent = this->ptr_->get_parent();
+					}
+					this->ptr_ = parent;
+				}
+				return *this;
+			}
+
+			const_iterator operator++(int)
+			{
+				const_iterator tmp = *this;
+				++(*this);
+				return tmp;
+			}
+
+			const_iterator& operator--()
+			{
+				if (this->ptr_->left->left) {
+					this->ptr_ = this->ptr_->left;
+					if (this->ptr_->right->left != this->ptr_) {
+						while (this->ptr_->right->right) {
+							this->ptr_ = this->ptr_->right;
+						}
+					}
+				}
+				else {
+					rbt_node* parent = this->ptr_->get_parent();
+					while (parent->right != this->ptr_) {
+						this->ptr_ = parent;
+						parent = this->ptr_->get_parent();
+					}
+					this->ptr_ = parent;
+				}
+				return *this;
+			}
+
+			const_iterator operator--(int)
+			{
+				const_iterator tmp = *this;
+				--(*this);
+				return tmp;
+			}
+		};
+
+	protected:
+		// a red-black tree of n nodes is at most 2 * log2(n + 1) high
+		enum { max_height = 2 * sizeof(std::size_t) * CHAR_BIT + 2 };
+
+		key_compare comp_;
+		allocator_type alloc_;
+		node_allocator_type node_alloc_;
+		rbt_node* ghost_node_;
+		rbt_node* nil_node_;
+		rbt_node* root_node_;
+		size_type size_;
+
+	public:
+		explicit rb_tree(key_compare const& comp = key_compare(),
+				allocator_type const& alloc = allocator_type()) :
+			comp_(comp),
+			alloc_(alloc),
+			node_alloc_(),
+			ghost_node_(this->node_alloc_.allocate(1)),
+			nil_node_(rbt_node::get_nil()),
+			root_node_(this->nil_node_),
+			size_(0)
+		{
+			this->ghost_node_->set_parent(this->ghost_node_);
+			this->ghost_node_->left = this->ghost_node_;
+			this->ghost_node_->right = this->ghost_node_;
+			this->ghost_node_->set_red(false);
+			return;
+		}
+
+		rb_tree(rb_tree const& x) :
+			comp_(x.comp_),
+			alloc_(x.alloc_),
+			node_alloc_(x.node_alloc_),
+			ghost_node_(this->node_alloc_.allocate(1)),
+			nil_node_(rbt_node::get_nil()),
+			root_node_(this->nil_node_),
+			size_(0)
+		{
+			this->ghost_node_->set_parent(this->ghost_node_);
+			this->ghost_node_->left = this->ghost_node_;
+			this->ghost_node_->right = this->ghost_node_;
+			this->ghost_node_->set_red(false);
+			*this = x;
+			return;
+		}
+
+		~rb_tree()
+		{
+			this->clear();
+			this->node_alloc_.deallocate(this->ghost_node_, 1);
+			return;
+		}
+
+		// x being sorted, every value is appended after the max node.
+		rb_tree& operator=(rb_tree const& x)
+		{
+			if (this == &x) {
+				return *this;
+			}
+			this->clear();
+			this->comp_ = x.comp_;
+			for (const_iterator cit = x.begin(), cite = x.end();
+					cit != cite; ++cit) {
+				this->insert_equal(this->end(), *cit);
+			}
+			return *this;
+		}
+
+#if __cplusplus >= 201103L
+		rb_tree(rb_tree&& x) :
+			rb_tree(x.comp_, x.alloc_)
+		{
+			this->swap(x);
+			return;
+		}
+
+		rb_tree& operator=(rb_tree&& x)
+		{
+			if (this != &x) {
+				this->clear();
+				this->swap(x);
+			}
+			return *this;
+		}
+#endif
+
+		iterator begin()
+		{
+			return this->begin_impl();
+		}
+
+		const_iterator begin() const
+		{
+			return const_iterator(this->begin_impl());
+		}
+
+		iterator end()
+		{
+			return this->end_impl();
+		}
+
+		const_iterator end() const
+		{
+			return const_iterator(this->end_impl());
+		}
+
+		reverse_iterator rbegin()
+		{
+			return reverse_iterator(this->ghost_node_);
+		}
+
+		const_reverse_iterator rbegin() const
+		{
+			return const_reverse_iterator(this->ghost_node_);
+		}
+
+		reverse_iterator rend()
+		{
+			return reverse_iterator(this->ghost_node_->right);
+		}
+
+		const_reverse_iterator rend() const
+		{
+			return const_reverse_iterator(this->ghost_node_->right);
+		}
+
+		bool empty() const
+		{
+			return this->size_ == 0;
+		}
+
+		size_type size() const
+		{
+			return this->size_;
+		}
+
+		size_type max_size() const
+		{
+			return this->node_alloc_.max_size();
+		}
+
+		ft::pair<iterator,bool> insert_unique(value_type const& val)
+		{
+			if (this->root_node_ == this->nil_node_) {
+				return this->insert_to_root(this->create_rbt_node(val));
+			}
+			rbt_node* parent = NULL;
+			rbt_node** node_ptr = NULL;
+			rbt_node* node = this->find_insert_position(KeyOfValue()(val),
+					parent, node_ptr);
+			if (node != NULL) {
+				return ft::pair<iterator,bool>(node, false);
+			}
+			return this->insert_node(parent, node_ptr, this->create_rbt_node(val));
+		}
+
+		// The value is linked next to position when it belongs right before
+		// or right after it, in amortized O(1). Appending with end() as hint
+		// only compares with the max node.
+		iterator insert_unique(iterator position, value_type const& val)
+		{
+			if (this->root_node_ == this->nil_node_) {
+				return this->insert_to_root(this->create_rbt_node(val)).first;
+			}
+			rbt_node* parent = NULL;
+			rbt_node** node_ptr = NULL;
+			rbt_node* node = this->find_hint_position(position,
+					KeyOfValue()(val), parent, node_ptr);
+			if (node != NULL) {
+				return iterator(node);
+			}
+			return this->insert_node(parent, node_ptr,
+					this->create_rbt_node(val)).first;
+		}
+
+		// The value is constructed once in its node. When its key is one of
+		// the arguments it is looked up first and a duplicate allocates
+		// nothing, otherwise the node is freed when its key is present.
+#if __cplusplus >= 201103L
+		template <class... Args>
+		ft::pair<iterator,bool> emplace_unique(Args&&... args)
+		{
+			return this->insert_unique_or_destroy(
+					this->emplace_rbt_node(std::forward<Args>(args)...));
+		}
+
+		template <class V>
+		typename ft::enable_if<ft::is_same<typename std::decay<V>::type,
+			value_type>::value, ft::pair<iterator,bool> >::type
+		emplace_unique(V&& val)
+		{
+			return this->emplace_unique_key(KeyOfValue()(val),
+					std::forward<V>(val));
+		}
+
+		template <class A1, class A2>
+		typename ft::enable_if<ft::is_key_argument<key_type, value_type,
+			typename std::decay<A1>::type>::value, ft::pair<iterator,bool> >::type
+		emplace_unique(A1&& a1, A2&& a2)
+		{
+			return this->emplace_unique_key(a1, std::forward<A1>(a1),
+					std::forward<A2>(a2));
+		}
+
+		template <class... Args>
+		iterator emplace_hint_unique(iterator position, Args&&... args)
+		{
+			return this->insert_hint_unique_or_destroy(position,
+					this->emplace_rbt_node(std::forward<Args>(args)...));
+		}
+
+		template <class V>
+		typename ft::enable_if<ft::is_same<typename std::decay<V>::type,
+			value_type>::value, iterator>::type
+		emplace_hint_unique(iterator position, V&& val)
+		{
+			return this->emplace_hint_unique_key(position, KeyOfValue()(val),
+					std::forward<V>(val));
+		}
+
+		template <class A1, class A2>
+		typename ft::enable_if<ft::is_key_argument<key_type, value_type,
+			typename std::decay<A1>::type>::value, iterator>::type
+		emplace_hint_unique(iterator position, A1&& a1, A2&& a2)
+		{
+			return this->emplace_hint_unique_key(position, a1,
+					std::forward<A1>(a1), std::forward<A2>(a2));
+		}
+#else
+		template <class A1>
+		ft::pair<iterator,bool> emplace_unique(A1 const& a1)
+		{
+			return this->insert_unique_or_destroy(this->emplace_rbt_node(a1));
+		}
+
+		ft::pair<iterator,bool> emplace_unique(value_type const& val)
+		{
+			return this->insert_unique(val);
+		}
+
+		template <class A1, class A2>
+		typename ft::enable_if<!ft::is_key_argument<key_type, value_type,
+			A1>::value, ft::pair<iterator,bool> >::type
+		emplace_unique(A1 const& a1, A2 const& a2)
+		{
+			return this->insert_unique_or_destroy(
+					this->emplace_rbt_node(a1, a2));
+		}
+
+		template <class A1, class A2>
+		typename ft::enable_if<ft::is_key_argument<key_type, value_type,
+			A1>::value, ft::pair<iterator,bool> >::type
+		emplace_unique(A1 const& a1, A2 const& a2)
+		{
+			return this->emplace_unique_key(a1, a1, a2);
+		}
+
+		template <class A1>
+		iterator emplace_hint_unique(iterator position, A1 const& a1)
+		{
+			return this->insert_hint_unique_or_destroy(position,
+					this->emplace_rbt_node(a1));
+		}
+
+		iterator emplace_hint_unique(iterator position, value_type const& val)
+		{
+			return this->insert_unique(position, val);
+		}
+
+		template <class A1, class A2>
+		typename ft::enable_if<!ft::is_key_argument<key_type, value_type,
+			A1>::value, iterator>::type
+		emplace_hint_unique(iterator position, A1 const& a1, A2 const& a2)
+		{
+			return this->insert_hint_unique_or_destroy(position,
+					this->emplace_rbt_node(a1, a2));
+		}
+
+		template <class A1, class A2>
+		typename ft::enable_if<ft::is_key_argument<key_type, value_type,
+			A1>::value, iterator>::type
+		emplace_hint_unique(iterator position, A1 const& a1, A2 const& a2)
+		{
+			return this->emplace_hint_unique_key(position, a1, a1, a2);
+		}
+#endif
+
+		// Links node, whose key must not be present, without copying its
+		// value. Otherwise the node of that key is returned and the caller
+		// keeps node.
+		ft::pair<iterator,bool> insert_unique_node(rbt_node* node)
+		{
+			if (this->root_node_ == this->nil_node_) {
+				return this->insert_to_root(node);
+			}
+			rbt_node* parent = NULL;
+			rbt_node** node_ptr = NULL;
+			rbt_node* existing = this->find_insert_position(
+					KeyOfValue()(node->val), parent, node_ptr);
+			if (existing != NULL) {
+				return ft::pair<iterator,bool>(existing, false);
+			}
+			return this->insert_node(parent, node_ptr, node);
+		}
+
+		iterator insert_equal(value_type const& val)
+		{
+			if (this->root_node_ == this->nil_node_) {
+				return this->insert_to_root(this->create_rbt_node(val)).first;
+			}
+			rbt_node* parent = NULL;
+			rbt_node** node_ptr = NULL;
+			this->find_upper_insert_position(KeyOfValue()(val), parent,
+					node_ptr);
+			return this->insert_node(parent, node_ptr,
+					this->create_rbt_node(val)).first;
+		}
+
+		// Links val right before position when it belongs there, so sorted
+		// input inserted at end() costs amortized constant time. Otherwise,
+		// like std, val is linked as close to position as it can, falling
+		// back to the lower bound when it is past position and to the upper
+		// bound when it is before.
+		iterator insert_equal(iterator position, value_type const& val)
+		{
+			if (this->root_node_ == this->nil_node_) {
+				return this->insert_to_root(this->create_rbt_node(val)).first;
+			}
+			rbt_node* node = position.ptr_;
+			if (node != this->ghost_node_ && this->comp_(KeyOfValue()(node->val),
+						KeyOfValue()(val)) == true) {
+				return this->insert_equal_after(position, val);
+			}
+			if (node == this->ghost_node_->right) {
+				return this->insert_node(node, &node->left,
+						this->create_rbt_node(val)).first;
+			}
+			iterator previous = position;
+			--previous;
+			if (this->comp_(KeyOfValue()(val), KeyOfValue()(*previous)) == true) {
+				return this->insert_equal(val);
+			}
+			if (node != this->ghost_node_ && node->left == this->nil_node_) {
+				return this->insert_node(node, &node->left,
+						this->create_rbt_node(val)).first;
+			}
+			return this->insert_node(previous.ptr_, &previous.ptr_->right,
+					this->create_rbt_node(val)).first;
+		}
+
+		void erase(iterator position)
+		{
+			this->unlink_rbt_node(position.ptr_);
+			this->destroy_rbt_node(position.ptr_);
+			return;
+		}
+
+		size_type erase_unique(key_type const& k)
+		{
+			rbt_node* node = this->root_node_;
+			while (node != this->nil_node_ && node != this->ghost_node_) {
+				if (this->comp_(k, KeyOfValue()(node->val)) == true) {
+					node = node->left;
+				}
+				else if (this->comp_(KeyOfValue()(node->val), k) == true) {
+					node = node->right;
+				}
+				else {
+					this->erase(iterator(node));
+					return 1;
+				}
+			}
+			return 0;
+		}
+
+		size_type erase_equal(key_type const& k)
+		{
+			iterator first = this->lower_bound(k);
+			iterator last = this->upper_bound(k);
+			size_type erased = 0;
+			while (first != last) {
+				this->erase(first++);
+				erased++;
+			}
+			return erased;
+		}
+
+		// Unlinks the node at position, the caller takes its ownership.
+		rbt_node* extract(iterator position)
+		{
+			this->unlink_rbt_node(position.ptr_);
+			return position.ptr_;
+		}
+
+		void erase(iterator first, iterator last)
+		{
+			while (first != last) {
+				this->erase(first++);
+			}
+			return;
+		}
+
+		// Splits the tree around the range and joins the remaining parts back,
+		// erased nodes are freed without any rebalancing. The split being by
+		// key, the keys must be unique.
+		void erase_unique(iterator first, iterator last)
+		{
+			if (first == last) {
+				return;
+			}
+			iterator next = first;
+			++next;
+			if (next == last) {
+				this->erase(first);
+				return;
+			}
+			if (first == this->begin() && last == this->end()) {
+				this->clear();
+				return;
+			}
+			this->detach_ghost_node();
+			rbt_node* lower = NULL;
+			rbt_node* upper = NULL;
+			rbt_node* pivot = NULL;
+			size_type lower_height = 0;
+			size_type upper_height = 0;
+			this->split_rbt(this->root_node_, this->black_height(this->root_node_),
+					KeyOfValue()(first.ptr_->val), lower, lower_height, pivot,
+					upper, upper_height);
+			size_type erased = 1;
+			if (last == this->end()) {
+				erased += this->clear_rbt(upper);
+				this->root_node_ = lower;
+			}
+			else {
+				rbt_node* middle = NULL;
+				rbt_node* last_pivot = NULL;
+				size_type middle_height = 0;
+				this->split_rbt(upper, upper_height, KeyOfValue()(last.ptr_->val),
+						middle, middle_height, last_pivot, upper, upper_height);
+				erased += this->clear_rbt(middle);
+				this->root_node_ = this->join_rbt(lower, lower_height, last_pivot,
+						upper, upper_height, upper_height);
+			}
+			this->destroy_rbt_node(pivot);
+			this->size_ -= erased;
+			this->attach_ghost_node();
+			return;
+		}
+
+		void swap(rb_tree& x)
+		{
+			key_compare key_compare_tmp = this->comp_;
+			this->comp_ = x.comp_;
+			x.comp_ = key_compare_tmp;
+			allocator_type allocator_tmp = this->alloc_;
+			this->alloc_ = x.alloc_;
+			x.alloc_ = allocator_tmp;
+			node_allocator_type node_allocator_tmp = this->node_alloc_;
+			this->node_alloc_ = x.node_alloc_;
+			x.node_alloc_ = node_allocator_tmp;
+			rbt_node* node_tmp = this->ghost_node_;
+			this->ghost_node_ = x.ghost_node_;
+			x.ghost_node_ = node_tmp;
+			node_tmp = this->root_node_;
+			this->root_node_ = x.root_node_;
+			x.root_node_ = node_tmp;
+			size_type size_tmp = this->size_;
+			this->size_ = x.size_;
+			x.size_ = size_tmp;
+		}
+
+		// Moves the elements whose key is not lower than k to upper, cleared
+		// first. The trees are split in O(log n) but the sizes need the
+		// smaller part to be counted. Both trees must use equal allocators.
+		void split(key_type const& k, rb_tree& upper)
+		{
+			if (&upper == this) {
+				return;
+			}
+			upper.clear();
+			iterator first = this->lower_bound(k);
+			if (first == this->end()) {
+				return;
+			}
+			iterator forward = first;
+			iterator backward = first;
+			size_type steps = 0;
+			while (forward != this->end() && backward != this->begin()) {
+				++forward;
+				--backward;
+				steps++;
+			}
+			size_type upper_size = steps;
+			if (forward != this->end()) {
+				upper_size = this->size_ - steps;
+			}
+			this->detach_ghost_node();
+			rbt_node* lower = NULL;
+			rbt_node* upper_root = NULL;
+			rbt_node* pivot = NULL;
+			size_type lower_height = 0;
+			size_type upper_height = 0;
+			this->split_rbt(this->root_node_, this->black_height(this->root_node_),
+					KeyOfValue()(first.ptr_->val), lower, lower_height, pivot,
+					upper_root, upper_height);
+			upper.root_node_ = this->join_rbt(this->nil_node_, 0, pivot,
+					upper_root, upper_height, upper_height);
+			upper.size_ = upper_size;
+			upper.attach_ghost_node();
+			this->root_node_ = lower;
+			this->size_ -= upper_size;
+			this->attach_ghost_node();
+			return;
+		}
+
+		// Moves the nodes of x to the rb_tree without copying them. Trees whose
+		// keys are all lower or all greater than the other ones are joined in
+		// O(log n) and x is left empty, otherwise the nodes of x are relinked
+		// one by one and those whose key is already present stay in x.
+		void join(rb_tree& x)
+		{
+			if (&x == this || x.empty() == true) {
+				return;
+			}
+			if (this->empty() == true) {
+				this->swap(x);
+				return;
+			}
+			bool x_is_upper = this->comp_(
+					KeyOfValue()(this->ghost_node_->left->val),
+					KeyOfValue()(x.ghost_node_->right->val));
+			if (x_is_upper == false && this->comp_(
+						KeyOfValue()(x.ghost_node_->left->val),
+						KeyOfValue()(this->ghost_node_->right->val)) == false) {
+				this->merge_unique(x);
+				return;
+			}
+			rb_tree& lower = x_is_upper ? *this : x;
+			rb_tree& upper = x_is_upper ? x : *this;
+			lower.detach_ghost_node();
+			upper.detach_ghost_node();
+			rbt_node* lower_root = lower.root_node_;
+			rbt_node* empty = NULL;
+			rbt_node* pivot = NULL;
+			rbt_node* upper_root = NULL;
+			size_type empty_height = 0;
+			size_type upper_height = 0;
+			this->split_rbt(upper.root_node_, this->black_height(upper.root_node_),
+					KeyOfValue()(upper.ghost_node_->right->val), empty,
+					empty_height, pivot, upper_root, upper_height);
+			this->root_node_ = this->join_rbt(lower_root,
+					this->black_height(lower_root), pivot, upper_root,
+					upper_height, upper_height);
+			this->size_ += x.size_;
+			this->attach_ghost_node();
+			x.root_node_ = x.nil_node_;
+			x.size_ = 0;
+			x.attach_ghost_node();
+			return;
+		}
+
+		// Relinks the nodes of source whose key is not in the rb_tree, without
+		// copying nor reallocating them. The other ones stay in source.
+		void merge_unique(rb_tree& source)
+		{
+			if (&source == this || source.empty() == true) {
+				return;
+			}
+			if (this->empty() == true
+					|| this->comp_(KeyOfValue()(this->ghost_node_->left->val),
+						KeyOfValue()(source.ghost_node_->right->val)) == true
+					|| this->comp_(KeyOfValue()(source.ghost_node_->left->val),
+						KeyOfValue()(this->ghost_node_->right->val)) == true) {
+				this->join(source);
+				return;
+			}
+			iterator it = source.begin();
+			while (it != source.end()) {
+				rbt_node* source_node = it.ptr_;
+				++it;
+				rbt_node* parent = NULL;
+				rbt_node** node_ptr = NULL;
+				if (this->find_insert_position(KeyOfValue()(source_node->val),
+							parent, node_ptr) == NULL) {
+					source.unlink_rbt_node(source_node);
+					this->insert_node(parent, node_ptr, source_node);
+				}
+			}
+			return;
+		}
+
+		void clear()
+		{
+			this->clear_rbt(this->root_node_);
+			this->root_node_ = this->nil_node_;
+			this->ghost_node_->set_parent(this->ghost_node_);
+			this->ghost_node_->left = this->ghost_node_;
+			this->ghost_node_->right = this->ghost_node_;
+			this->size_ = 0;
+		}
+
+		key_compare key_comp() const
+		{
+			return this->comp_;
+		}
+
+		iterator find(key_type const& k)
+		{
+			return this->find_impl(k);
+		}
+
+		const_iterator find(key_type const& k) const
+		{
+			return this->find_impl(k);
+		}
+
+		size_type count(key_type const& k) const
+		{
+			const_iterator first = this->lower_bound(k);
+			const_iterator last = this->upper_bound(k);
+			size_type n = 0;
+			while (first != last) {
+				n++;
+				++first;
+			}
+			return n;
+		}
+
+		iterator lower_bound(key_type const& k)
+		{
+			return this->lower_bound_impl(k);
+		}
+
+		const_iterator lower_bound(key_type const& k) const
+		{
+			return const_iterator(this->lower_bound_impl(k));
+		}
+
+		iterator upper_bound(key_type const& k)
+		{
+			return this->upper_bound_impl(k);
+		}
+
+		const_iterator upper_bound(key_type const& k) const
+		{
+			return const_iterator(this->upper_bound_impl(k));
+		}
+
+		pair<const_iterator,const_iterator> equal_range(key_type const& k) const
+		{
+			return pair<const_iterator,const_iterator>(this->lower_bound_impl(k),
+					this->upper_bound_impl(k));
+		}
+
+		pair<iterator,iterator> equal_range(key_type const& k)
+		{
+			return pair<iterator,iterator>(this->lower_bound_impl(k),
+					this->upper_bound_impl(k));
+		}
+
+		// One descent when k is present.
+		pair<iterator,iterator> equal_range_unique(key_type const& k) const
+		{
+			return this->equal_range_impl(k);
+		}
+
+		allocator_type get_allocator() const
+		{
+			return this->alloc_;
+		}
+
+		node_allocator_type get_node_allocator() const
+		{
+			return this->node_alloc_;
+		}
+
+		// Calls fn on the values whose key is in [lo, hi), in order.
+		template <class Function>
+		Function for_each_in_range(key_type const& lo, key_type const& hi,
+				Function fn)
+		{
+			return this->template for_each_in_range_impl<Function, reference>(lo,
+					hi, fn);
+		}
+
+		template <class Function>
+		Function for_each_in_range(key_type const& lo, key_type const& hi,
+				Function fn) const
+		{
+			return this->template for_each_in_range_impl<Function,
+					const_reference>(lo, hi, fn);
+		}
+
+	protected:
+		// The nodes left to visit are kept on a stack instead of climbing
+		// parent links, and the right child of a stacked node is prefetched
+		// while its left subtree is visited.
+		template <class Function, class Reference>
+		Function for_each_in_range_impl(key_type const& lo, key_type const& hi,
+				Function fn) const
+		{
+			rbt_node* stack[max_height];
+			int depth = 0;
+			rbt_node* node = this->root_node_;
+			while (node != this->nil_node_ && node != this->ghost_node_) {
+				if (this->comp_(KeyOfValue()(node->val), lo) == true) {
+					node = node->right;
+				}
+				else {
+					__builtin_prefetch(node->right);
+					stack[depth++] = node;
+					node = node->left;
+				}
+			}
+			while (depth > 0) {
+				node = stack[--depth];
+				if (this->comp_(KeyOfValue()(node->val), hi) == false) {
+					break;
+				}
+				Reference val = node->val;
+				fn(val);
+				node = node->right;
+				while (node != this->nil_node_ && node != this->ghost_node_) {
+					__builtin_prefetch(node->right);
+					stack[depth++] = node;
+					node = node->left;
+				}
+			}
+			return fn;
+		}
+
+		iterator begin_impl() const
+		{
+			return iterator(this->ghost_node_->right);
+		}
+
+		iterator end_impl() const
+		{
+			return iterator(this->ghost_node_);
+		}
+
+		// Only val is constructed, the node links are set by hand.
+		rbt_node* create_rbt_node(value_type const& val)
+		{
+			rbt_node* node = this->node_alloc_.allocate(1);
+			try {
+				this->alloc_.construct(&node->val, val);
+			}
+			catch (...) {
+				this->node_alloc_.deallocate(node, 1);
+				throw;
+			}
+			return this->init_rbt_node(node);
+		}
+
+#if __cplusplus >= 201103L
+		template <class... Args>
+		rbt_node* emplace_rbt_node(Args&&... args)
+		{
+			rbt_node* node = this->node_alloc_.allocate(1);
+			try {
+				std::allocator_traits<allocator_type>::construct(this->alloc_,
+						&node->val, std::forward<Args>(args)...);
+			}
+			catch (...) {
+				this->node_alloc_.deallocate(node, 1);
+				throw;
+			}
+			return this->init_rbt_node(node);
+		}
+
+		template <class... Args>
+		ft::pair<iterator,bool> emplace_unique_key(key_type const& k,
+				Args&&... args)
+		{
+			if (this->root_node_ == this->nil_node_) {
+				return this->insert_to_root(
+						this->emplace_rbt_node(std::forward<Args>(args)...));
+			}
+			rbt_node* parent = NULL;
+			rbt_node** node_ptr = NULL;
+			rbt_node* node = this->find_insert_position(k, parent, node_ptr);
+			if (node != NULL) {
+				return ft::pair<iterator,bool>(node, false);
+			}
+			return this->insert_node(parent, node_ptr,
+					this->emplace_rbt_node(std::forward<Args>(args)...));
+		}
+
+		template <class... Args>
+		iterator emplace_hint_unique_key(iterator position, key_type const& k,
+				Args&&... args)
+		{
+			if (this->root_node_ == this->nil_node_) {
+				return this->insert_to_root(
+						this->emplace_rbt_node(std::forward<Args>(args)...)).first;
+			}
+			rbt_node* parent = NULL;
+			rbt_node** node_ptr = NULL;
+			rbt_node* node = this->find_hint_position(position, k, parent,
+					node_ptr);
+			if (node != NULL) {
+				return iterator(node);
+			}
+			return this->insert_node(parent, node_ptr,
+					this->emplace_rbt_node(std::forward<Args>(args)...)).first;
+		}
+#else
+		template <class A1>
+		rbt_node* emplace_rbt_node(A1 const& a1)
+		{
+			rbt_node* node = this->node_alloc_.allocate(1);
+			try {
+				::new (static_cast<void*>(&node->val)) value_type(a1);
+			}
+			catch (...) {
+				this->node_alloc_.deallocate(node, 1);
+				throw;
+			}
+			return this->init_rbt_node(node);
+		}
+
+		template <class A1, class A2>
+		rbt_node* emplace_rbt_node(A1 const& a1, A2 const& a2)
+		{
+			rbt_node* node = this->node_alloc_.allocate(1);
+			try {
+				::new (static_cast<void*>(&node->val)) value_type(a1, a2);
+			}
+			catch (...) {
+				this->node_alloc_.deallocate(node, 1);
+				throw;
+			}
+			return this->init_rbt_node(node);
+		}
+
+		template <class A1, class A2>
+		ft::pair<iterator,bool> emplace_unique_key(key_type const& k,
+				A1 const& a1, A2 const& a2)
+		{
+			if (this->root_node_ == this->nil_node_) {
+				return this->insert_to_root(this->emplace_rbt_node(a1, a2));
+			}
+			rbt_node* parent = NULL;
+			rbt_node** node_ptr = NULL;
+			rbt_node* node = this->find_insert_position(k, parent, node_ptr);
+			if (node != NULL) {
+				return ft::pair<iterator,bool>(node, false);
+			}
+			return this->insert_node(parent, node_ptr,
+					this->emplace_rbt_node(a1, a2));
+		}
+
+		template <class A1, class A2>
+		iterator emplace_hint_unique_key(iterator position, key_type const& k,
+				A1 const& a1, A2 const& a2)
+		{
+			if (this->root_node_ == this->nil_node_) {
+				return this->insert_to_root(this->emplace_rbt_node(a1, a2)).first;
+			}
+			rbt_node* parent = NULL;
+			rbt_node** node_ptr = NULL;
+			rbt_node* node = this->find_hint_position(position, k, parent,
+					node_ptr);
+			if (node != NULL) {
+				return iterator(node);
+			}
+			return this->insert_node(parent, node_ptr,
+					this->emplace_rbt_node(a1, a2)).first;
+		}
+#endif
+
+		rbt_node* init_rbt_node(rbt_node* node)
+		{
+			node->set_parent_and_color(NULL, true);
+			node->left = this->nil_node_;
+			node->right = this->nil_node_;
+			return node;
+		}
+
+		// Links node, built before its key could be looked up, or frees it
+		// when the key is present.
+		ft::pair<iterator,bool> insert_unique_or_destroy(rbt_node* node)
+		{
+			ft::pair<iterator,bool> inserted = this->insert_unique_node(node);
+			if (inserted.second == false) {
+				this->destroy_rbt_node(node);
+			}
+			return inserted;
+		}
+
+		iterator insert_hint_unique_or_destroy(iterator position, rbt_node* node)
+		{
+			if (this->root_node_ == this->nil_node_) {
+				return this->insert_to_root(node).first;
+			}
+			rbt_node* parent = NULL;
+			rbt_node** node_ptr = NULL;
+			rbt_node* existing = this->find_hint_position(position,
+					KeyOfValue()(node->val), parent, node_ptr);
+			if (existing != NULL) {
+				this->destroy_rbt_node(node);
+				return iterator(existing);
+			}
+			return this->insert_node(parent, node_ptr, node).first;
+		}
+
+		// The node destructor only destroys val, it is skipped with the
+		// default allocator when val is trivially destructible.
+		void destroy_rbt_node(rbt_node* node)
+		{
+			if (ft::is_trivially_destructible<value_type>::value == false
+					|| ft::is_default_allocator<Alloc, Value>::value == false) {
+				this->node_alloc_.destroy(node);
+			}
+			this->node_alloc_.deallocate(node, 1);
+			return;
+		}
+
+		ft::pair<iterator, bool> insert_to_root(rbt_node* new_node)
+		{
+			this->root_node_ = new_node;
+			new_node->set_parent(NULL);
+			new_node->set_red(false);
+			new_node->left = this->ghost_node_;
+			new_node->right = this->ghost_node_;
+			this->ghost_node_->left = new_node;
+			this->ghost_node_->right = new_node;
+			this->size_++;
+			this->update_node(new_node);
+			return ft::pair<iterator,bool>(iterator(new_node), true);
+		}
+
+		ft::pair<iterator, bool> insert_node(rbt_node* parent, rbt_node** node_ptr,
+				rbt_node* new_node)
+		{
+			new_node->set_red(true);
+			new_node->left = this->nil_node_;
+			new_node->right = this->nil_node_;
+			if (parent == this->ghost_node_->right
+					&& &parent->left == node_ptr) {
+				this->ghost_node_->right = new_node;
+				new_node->left = this->ghost_node_;
+			}
+			else if (parent == this->ghost_node_->left
+					&& &parent->right == node_ptr) {
+				this->ghost_node_->left = new_node;
+				new_node->right = this->ghost_node_;
+			}
+			new_node->set_parent(parent);
+			*node_ptr = new_node;
+			this->size_++;
+			this->update_path(new_node);
+			fix_insertion(new_node);
+			return ft::pair<iterator,bool>(iterator(new_node), true);
+		}
+
+		// Returns the node of key k, or NULL and where such a node would be
+		// linked in a non empty tree.
+		rbt_node* find_insert_position(key_type const& k, rbt_node*& parent,
+				rbt_node**& node_ptr) const
+		{
+			rbt_node* node = this->root_node_;
+			while (1) {
+				if (this->comp_(k, KeyOfValue()(node->val)) == true) {
+					if (node->left == this->nil_node_
+							|| node->left == this->ghost_node_) {
+						parent = node;
+						node_ptr = &node->left;
+						return NULL;
+					}
+					node = node->left;
+				}
+				else if (this->comp_(KeyOfValue()(node->val), k) == true) {
+					if (node->right == this->nil_node_
+							|| node->right == this->ghost_node_) {
+						parent = node;
+						node_ptr = &node->right;
+						return NULL;
+					}
+					node = node->right;
+				}
+				else {
+					return node;
+				}
+			}
+		}
+
+		// Like find_insert_position, checking first whether k belongs right
+		// before or right after position.
+		rbt_node* find_hint_position(iterator position, key_type const& k,
+				rbt_node*& parent, rbt_node**& node_ptr) const
+		{
+			rbt_node* node = position.ptr_;
+			rbt_node* max = this->ghost_node_->left;
+			if (node == this->ghost_node_) {
+				if (this->comp_(KeyOfValue()(max->val), k) == true) {
+					parent = max;
+					node_ptr = &max->right;
+					return NULL;
+				}
+				return this->find_insert_position(k, parent, node_ptr);
+			}
+			if (this->comp_(k, KeyOfValue()(node->val)) == true) {
+				if (node == this->ghost_node_->right) {
+					parent = node;
+					node_ptr = &node->left;
+					return NULL;
+				}
+				iterator previous = position;
+				--previous;
+				if (this->comp_(KeyOfValue()(*previous), k) == true) {
+					if (previous.ptr_->right == this->nil_node_) {
+						parent = previous.ptr_;
+						node_ptr = &previous.ptr_->right;
+					}
+					else {
+						parent = node;
+						node_ptr = &node->left;
+					}
+					return NULL;
+				}
+				return this->find_insert_position(k, parent, node_ptr);
+			}
+			if (this->comp_(KeyOfValue()(node->val), k) == true) {
+				if (node == max) {
+					parent = node;
+					node_ptr = &node->right;
+					return NULL;
+				}
+				iterator next = position;
+				++next;
+				if (this->comp_(k, KeyOfValue()(*next)) == true) {
+					if (node->right == this->nil_node_) {
+						parent = node;
+						node_ptr = &node->right;
+					}
+					else {
+						parent = next.ptr_;
+						node_ptr = &next.ptr_->left;
+					}
+					return NULL;
+				}
+				return this->find_insert_position(k, parent, node_ptr);
+			}
+			return node;
+		}
+
+		// Links val, which is past position, as close to it as it can.
+		iterator insert_equal_after(iterator position, value_type const& val)
+		{
+			rbt_node* node = position.ptr_;
+			if (node == this->ghost_node_->left) {
+				return this->insert_node(node, &node->right,
+						this->create_rbt_node(val)).first;
+			}
+			iterator next = position;
+			++next;
+			if (this->comp_(KeyOfValue()(*next), KeyOfValue()(val)) == false) {
+				if (node->right == this->nil_node_) {
+					return this->insert_node(node, &node->right,
+							this->create_rbt_node(val)).first;
+				}
+				return this->insert_node(next.ptr_, &next.ptr_->left,
+						this->create_rbt_node(val)).first;
+			}
+			rbt_node* parent = NULL;
+			rbt_node** node_ptr = NULL;
+			this->find_lower_insert_position(KeyOfValue()(val), parent,
+					node_ptr);
+			return this->insert_node(parent, node_ptr,
+					this->create_rbt_node(val)).first;
+		}
+
+		// Where a node of key k would be linked before the equal ones in a
+		// non empty tree.
+		void find_lower_insert_position(key_type const& k, rbt_node*& parent,
+				rbt_node**& node_ptr) const
+		{
+			rbt_node* node = this->root_node_;
+			while (1) {
+				if (this->comp_(KeyOfValue()(node->val), k) == false) {
+					if (node->left == this->nil_node_
+							|| node->left == this->ghost_node_) {
+						parent = node;
+						node_ptr = &node->left;
+						return;
+					}
+					node = node->left;
+				}
+				else {
+					if (node->right == this->nil_node_
+							|| node->right == this->ghost_node_) {
+						parent = node;
+						node_ptr = &node->right;
+						return;
+					}
+					node = node->right;
+				}
+			}
+		}
+
+		// Where a node of key k would be linked after the equal ones in a non
+		// empty tree.
+		void find_upper_insert_position(key_type const& k, rbt_node*& parent,
+				rbt_node**& node_ptr) const
+		{
+			rbt_node* node = this->root_node_;
+			while (1) {
+				if (this->comp_(k, KeyOfValue()(node->val)) == true) {
+					if (node->left == this->nil_node_
+							|| node->left == this->ghost_node_) {
+						parent = node;
+						node_ptr = &node->left;
+						return;
+					}
+					node = node->left;
+				}
+				else {
+					if (node->right == this->nil_node_
+							|| node->right == this->ghost_node_) {
+						parent = node;
+						node_ptr = &node->right;
+						return;
+					}
+					node = node->right;
+				}
+			}
+		}
+
+		// Unlinks the node from the tree and rebalances it, without freeing
+		// the node.
+		void unlink_rbt_node(rbt_node* node)
+		{
+			rbt_node* new_min = NULL;
+			if (node->left == this->ghost_node_) {
+				iterator new_min_position(node);
+				++new_min_position;
+				new_min = new_min_position.ptr_;
+			}
+			rbt_node* new_max = NULL;
+			if (node->right == this->ghost_node_) {
+				iterator new_max_position(node);
+				--new_max_position;
+				new_max = new_max_position.ptr_;
+			}
+			bool original_is_red = node->is_red();
+			rbt_node* violating_node = NULL;
+			rbt_node* violating_parent = NULL;
+			if (node->left == this->nil_node_
+					|| node->left == this->ghost_node_) {
+				this->substitute_node(node, node->right);
+				violating_node = node->right;
+				violating_parent = node->get_parent();
+			}
+			else if (node->right == this->nil_node_
+					|| node->right == this->ghost_node_) {
+				this->substitute_node(node, node->left);
+				violating_node = node->left;
+				violating_parent = node->get_parent();
+			}
+			else {
+				rbt_node* substitute = node->right;
+				while (substitute->left != this->nil_node_
+						&& substitute->left != this->ghost_node_) {
+					substitute = substitute->left;
+				}
+				original_is_red = substitute->is_red();
+				violating_node = substitute->right;
+				if (substitute->get_parent() == node) {
+					violating_parent = substitute;
+				}
+				else {
+					violating_parent = substitute->get_parent();
+					this->substitute_node(substitute, substitute->right);
+					substitute->right = node->right;
+					substitute->right->set_parent(substitute);
+				}
+				this->substitute_node(node, substitute);
+				substitute->left = node->left;
+				substitute->left->set_parent(substitute);
+				substitute->set_red(node->is_red());
+			}
+			this->update_path(violating_parent);
+			if (original_is_red == false) {
+				fix_deletion(violating_node, violating_parent);
+			}
+			if (new_min) {
+				new_min->left = this->ghost_node_;
+				this->ghost_node_->right = new_min;
+			}
+			if (new_max) {
+				new_max->right = this->ghost_node_;
+				this->ghost_node_->left = new_max;
+			}
+			this->size_--;
+			if (this->size_ == 0) {
+				this->root_node_ = this->nil_node_;
+				this->ghost_node_->set_parent(this->ghost_node_);
+				this->ghost_node_->left = this->ghost_node_;
+				this->ghost_node_->right = this->ghost_node_;
+			}
+			return;
+		}
+
+		bool is_leaf(rbt_node const* node) const
+		{
+			return node == this->nil_node_ || node == this->ghost_node_;
+		}
+
+		void update_node(rbt_node* node) const
+		{
+			if (NodeUpdate::enabled == 0) {
+				return;
+			}
+			NodeUpdate()(node->val,
+					this->is_leaf(node->left) ? NULL : &node->left->val,
+					this->is_leaf(node->right) ? NULL : &node->right->val);
+			return;
+		}
+
+		// Updates the node and its ancestors.
+		void update_path(rbt_node* node) const
+		{
+			if (NodeUpdate::enabled == 0) {
+				return;
+			}
+			while (node != NULL) {
+				this->update_node(node);
+				node = node->get_parent();
+			}
+			return;
+		}
+
+		void left_rotate_node(rbt_node* node)
+		{
+			rbt_node* parent = node->get_parent();
+			rbt_node* right = node->right;
+			if (right->left != this->nil_node_) {
+				right->left->set_parent(node);
+			}
+			if (parent) {
+				if (parent->right == node) {
+					parent->right = right;
+				}
+				else {
+					parent->left = right;
+				}
+			}
+			else {
+				this->root_node_ = right;
+			}
+			node->set_parent(right);
+			node->right = right->left;
+			right->set_parent(parent);
+			right->left = node;
+			this->update_node(node);
+			this->update_node(right);
+			return;
+		}
+
+		void right_rotate_node(rbt_node* node)
+		{
+			rbt_node* parent = node->get_parent();
+			rbt_node* left = node->left;
+			if (left->right != this->nil_node_) {
+				left->right->set_parent(node);
+			}
+			if (parent) {
+				if (parent->right == node) {
+					parent->right = left;
+				}
+				else {
+					parent->left = left;
+				}
+			}
+			else {
+				this->root_node_ = left;
+			}
+			node->set_parent(left);
+			node->left = left->right;
+			left->set_parent(parent);
+			left->right = node;
+			this->update_node(node);
+			this->update_node(left);
+			return;
+		}
+
+		// Returns true when the black height of the tree grew.
+		bool fix_insertion(rbt_node* node)
+		{
+			rbt_node* parent = node->get_parent();
+			while (parent && parent->is_red() == true) {
+				rbt_node* grand_parent = node->get_grand_parent();
+				rbt_node* uncle = node->get_uncle();
+				if (uncle != this->nil_node_ && uncle->is_red() == true) {
+					parent->set_red(false);
+					grand_parent->set_red(true);
+					uncle->set_red(false);
+				}
+				else {
+					// triangle cases
+					if (grand_parent->right == parent && parent->left == node) {
+						right_rotate_node(parent);
+						node = parent;
+						parent = node->get_parent();
+					}
+					else if (grand_parent->left == parent
+							&& parent->right == node) {
+						left_rotate_node(parent);
+						node = parent;
+						parent = node->get_parent();
+					}
+					// line cases
+					if (grand_parent->right == parent
+							&& parent->right == node) {
+						left_rotate_node(grand_parent);
+						parent->set_red(false);
+						grand_parent->set_red(true);
+					}
+					else if (grand_parent->left == parent
+							&& parent->left == node) {
+						right_rotate_node(grand_parent);
+						parent->set_red(false);
+						grand_parent->set_red(true);
+					}
+				}
+				node = grand_parent;
+				parent = node->get_parent();
+			}
+			bool black_height_grew = this->root_node_->is_red();
+			this->root_node_->set_red(false);
+			return black_height_grew;
+		}
+
+		rbt_node* get_deletion_substitute(rbt_node* node) const
+		{
+			if (node->left != this->nil_node_
+					&& node->left != this->ghost_node_) {
+				if (node->right != this->nil_node_
+						&& node->right != this->ghost_node_) {
+					iterator successor_it(node);
+					++successor_it;
+					return successor_it.ptr_;
+				}
+				else {
+					return node->left;
+				}
+			}
+			else {
+				return node->right;
+			}
+		}
+
+		// The parent is given since node may be the shared nil sentinel,
+		// which is never written to.
+		void fix_deletion(rbt_node* node, rbt_node* parent)
+		{
+			rbt_node* sibling = NULL;
+			while (node != this->root_node_ && node->is_red() == false) {
+				if (parent->left == node) {
+					sibling = parent->right;
+					if (sibling->is_red() == true)
+					{
+						sibling->set_red(false);
+						parent->set_red(true);
+						left_rotate_node(parent);
+						sibling = parent->right;
+					}
+					if ((sibling->left == this->nil_node_
+								|| sibling->left == this->ghost_node_
+								|| sibling->left->is_red() == false)
+							&& (sibling->right == this->nil_node_
+								|| sibling->right == this->ghost_node_
+								|| sibling->right->is_red() == false)) {
+						sibling->set_red(true);
+						node = parent;
+						parent = node->get_parent();
+					}
+					else {
+						if (sibling->right == this->nil_node_
+								|| sibling->right == this->ghost_node_
+								|| sibling->right->is_red() == false) {
+							if (sibling->left != this->nil_node_
+									&& sibling->left != this->ghost_node_) {
+								sibling->left->set_red(false);
+							}
+							sibling->set_red(true);
+							right_rotate_node(sibling);
+							sibling = parent->right;
+						}
+						sibling->set_red(parent->is_red());
+						parent->set_red(false);
+						if (sibling->right != this->nil_node_
+								&& sibling->right != this->ghost_node_) {
+							sibling->right->set_red(false);
+						}
+						left_rotate_node(parent);
+						node = this->root_node_;
+						parent = NULL;
+					}
+				}
+				else {
+					sibling = parent->left;
+					if (sibling->is_red() == true)
+					{
+						sibling->set_red(false);
+						parent->set_red(true);
+						right_rotate_node(parent);
+						sibling = parent->left;
+					}
+					if ((sibling->right == this->nil_node_
+								|| sibling->right == this->ghost_node_
+								|| sibling->right->is_red() == false)
+							&& (sibling->left == this->nil_node_
+								|| sibling->left == this->ghost_node_
+								|| sibling->left->is_red() == false)) {
+						sibling->set_red(true);
+						node = parent;
+						parent = node->get_parent();
+					}
+					else {
+						if (sibling->left == this->nil_node_
+								|| sibling->left == this->ghost_node_
+								|| sibling->left->is_red() == false) {
+							if (sibling->right != this->nil_node_
+									&& sibling->right != this->ghost_node_) {
+								sibling->right->set_red(false);
+							}
+							sibling->set_red(true);
+							left_rotate_node(sibling);
+							sibling = parent->left;
+						}
+						sibling->set_red(parent->is_red());
+						parent->set_red(false);
+						if (sibling->left != this->nil_node_
+								&& sibling->left != this->ghost_node_) {
+							sibling->left->set_red(false);
+						}
+						right_rotate_node(parent);
+						node = this->root_node_;
+						parent = NULL;
+					}
+				}
+			}
+			if (node != this->nil_node_ && node != this->ghost_node_) {
+				node->set_red(false);
+			}
+			return;
+		}
+
+		void substitute_node(rbt_node* node, rbt_node* substitute)
+		{
+			if (substitute != this->nil_node_
+					&& substitute != this->ghost_node_) {
+				substitute->set_parent(node->get_parent());
+			}
+			if (node->get_parent()) {
+				if (node->get_parent()->left == node) {
+					node->get_parent()->left = substitute;
+				}
+				else {
+					node->get_parent()->right = substitute;
+				}
+			}
+			else {
+				this->root_node_ = substitute;
+			}
+			return;
+		}
+
+		// Rotates left children up until there is none so the subtree is
+		// freed without recursion nor stack, returns the number of nodes freed.
+		size_type clear_rbt(rbt_node* node)
+		{
+			size_type count = 0;
+			while (node != this->nil_node_ && node != this->ghost_node_) {
+				rbt_node* left = node->left;
+				if (left != this->nil_node_ && left != this->ghost_node_) {
+					node->left = left->right;
+					left->right = node;
+					node = left;
+				}
+				else {
+					rbt_node* right = node->right;
+					this->destroy_rbt_node(node);
+					count++;
+					node = right;
+				}
+			}
+			return count;
+		}
+
+		size_type black_height(rbt_node* node) const
+		{
+			size_type height = 0;
+			while (node != this->nil_node_ && node != this->ghost_node_) {
+				if (node->is_red() == false) {
+					height++;
+				}
+				node = node->left;
+			}
+			return height;
+		}
+
+		void detach_ghost_node()
+		{
+			this->ghost_node_->right->left = this->nil_node_;
+			this->ghost_node_->left->right = this->nil_node_;
+			return;
+		}
+
+		void attach_ghost_node()
+		{
+			if (this->root_node_ == this->nil_node_) {
+				this->ghost_node_->set_parent(this->ghost_node_);
+				this->ghost_node_->left = this->ghost_node_;
+				this->ghost_node_->right = this->ghost_node_;
+				return;
+			}
+			this->root_node_->set_parent(NULL);
+			this->root_node_->set_red(false);
+			rbt_node* min = this->root_node_;
+			while (min->left != this->nil_node_) {
+				min = min->left;
+			}
+			rbt_node* max = this->root_node_;
+			while (max->right != this->nil_node_) {
+				max = max->right;
+			}
+			min->left = this->ghost_node_;
+			this->ghost_node_->right = min;
+			max->right = this->ghost_node_;
+			this->ghost_node_->left = max;
+			return;
+		}
+
+		// Joins two detached trees of black heights lower_height and
+		// upper_height with node, whose value is between them, in
+		// O(|lower_height - upper_height|). root_node_ is used as the root of
+		// the tree being fixed.
+		rbt_node* join_rbt(rbt_node* lower, size_type lower_height,
+				rbt_node* node, rbt_node* upper, size_type upper_height,
+				size_type& height)
+		{
+			if (lower != this->nil_node_ && lower->is_red() == true) {
+				lower->set_red(false);
+				lower_height++;
+			}
+			if (upper != this->nil_node_ && upper->is_red() == true) {
+				upper->set_red(false);
+				upper_height++;
+			}
+			if (lower_height == upper_height) {
+				node->left = lower;
+				node->right = upper;
+				if (lower != this->nil_node_) {
+					lower->set_parent(node);
+				}
+				if (upper != this->nil_node_) {
+					upper->set_parent(node);
+				}
+				node->set_parent(NULL);
+				node->set_red(false);
+				height = lower_height + 1;
+				return node;
+			}
+			node->set_red(true);
+			if (lower_height > upper_height) {
+				rbt_node* parent = NULL;
+				rbt_node* child = lower;
+				size_type child_height = lower_height;
+				while (child->is_red() == true || child_height > upper_height) {
+					if (child->is_red() == false) {
+						child_height--;
+					}
+					parent = child;
+					child = child->right;
+				}
+				node->left = child;
+				node->right = upper;
+				node->set_parent(parent);
+				parent->right = node;
+				this->root_node_ = lower;
+				height = lower_height;
+			}
+			else {
+				rbt_node* parent = NULL;
+				rbt_node* child = upper;
+				size_type child_height = upper_height;
+				while (child->is_red() == true || child_height > lower_height) {
+					if (child->is_red() == false) {
+						child_height--;
+					}
+					parent = child;
+					child = child->left;
+				}
+				node->left = lower;
+				node->right = child;
+				node->set_parent(parent);
+				parent->left = node;
+				this->root_node_ = upper;
+				height = upper_height;
+			}
+			if (node->left != this->nil_node_) {
+				node->left->set_parent(node);
+			}
+			if (node->right != this->nil_node_) {
+				node->right->set_parent(node);
+			}
+			if (this->fix_insertion(node) == true) {
+				height++;
+			}
+			return this->root_node_;
+		}
+
+		// Splits the detached tree rooted at node of black height height into
+		// the trees of the values lower and upper than k, pivot being the
+		// node of key k if any.
+		void split_rbt(rbt_node* node, size_type height, key_type const& k,
+				rbt_node*& lower, size_type& lower_height, rbt_node*& pivot,
+				rbt_node*& upper, size_type& upper_height)
+		{
+			if (node == this->nil_node_) {
+				lower = this->nil_node_;
+				lower_height = 0;
+				upper = this->nil_node_;
+				upper_height = 0;
+				return;
+			}
+			size_type child_height = height;
+			if (node->is_red() == false) {
+				child_height--;
+			}
+			rbt_node* left = node->left;
+			rbt_node* right = node->right;
+			if (left != this->nil_node_) {
+				left->set_parent(NULL);
+			}
+			if (right != this->nil_node_) {
+				right->set_parent(NULL);
+			}
+			if (this->comp_(k, KeyOfValue()(node->val)) == true) {
+				this->split_rbt(left, child_height, k, lower, lower_height, pivot,
+						upper, upper_height);
+				upper = this->join_rbt(upper, upper_height, node, right,
+						child_height, upper_height);
+			}
+			else if (this->comp_(KeyOfValue()(node->val), k) == true) {
+				this->split_rbt(right, child_height, k, lower, lower_height, pivot,
+						upper, upper_height);
+				lower = this->join_rbt(left, child_height, node, lower,
+						lower_height, lower_height);
+			}
+			else {
+				lower = left;
+				lower_height = child_height;
+				upper = right;
+				upper_height = child_height;
+				pivot = node;
+			}
+			return;
+		}
+
+		iterator find_impl(key_type const& k) const
+		{
+			rbt_node* node = this->root_node_;
+			while (node != this->nil_node_ && node != this->ghost_node_) {
+				if (this->comp_(k, KeyOfValue()(node->val)) == true) {
+					node = node->left;
+				}
+				else if (this->comp_(KeyOfValue()(node->val), k) == true) {
+					node = node->right;
+				}
+				else {
+					return iterator(node);
+				}
+			}
+			return this->end_impl();
+		}
+
+		iterator lower_bound_impl(key_type const& k) const
+		{
+			rbt_node* node = this->root_node_;
+			rbt_node* result = this->ghost_node_;
+			while (node != this->nil_node_ && node != this->ghost_node_) {
+				if (this->comp_(KeyOfValue()(node->val), k) == false) {
+					result = node;
+					node = node->left;
+				}
+				else {
+					node = node->right;
+				}
+			}
+			return iterator(result);
+		}
+
+		iterator upper_bound_impl(key_type const& k) const
+		{
+			rbt_node* node = this->root_node_;
+			rbt_node* result = this->ghost_node_;
+			while (node != this->nil_node_ && node != this->ghost_node_) {
+				if (this->comp_(k, KeyOfValue()(node->val)) == true) {
+					result = node;
+					node = node->left;
+				}
+				else {
+					node = node->right;
+				}
+			}
+			return iterator(result);
+		}
+
+		pair<iterator,iterator> equal_range_impl(key_type const& k) const
+		{
+			iterator it = this->find_impl(k);
+			if (it != this->end_impl()) {
+				iterator next = it;
+				++next;
+				return pair<iterator, iterator>(it, next);
+			}
+			it = this->upper_bound_impl(k);
+			return pair<iterator, iterator>(it, it);
+		}
+
+		void print_rbt() const
+		{
+			std::cout << "size = " << this->size() << std::endl;
+			std::cout << std::endl;
+			if (this->ghost_node_->left != this->ghost_node_) {
+				std::cout << "ghost->left = "
+					<< KeyOfValue()(this->ghost_node_->left->val) << std::endl;
+			}
+			if (this->ghost_node_->right != this->ghost_node_) {
+				std::cout << "ghost->right = "
+					<< KeyOfValue()(this->ghost_node_->right->val) << std::endl;
+			}
+			print_rbt(this->root_node_);
+			return;
+		}
+
+		void print_rbt(rbt_node* node) const
+		{
+			if (node == this->nil_node_ || node == this->ghost_node_) {
+				return;
+			}
+			std::cout << std::endl;
+			if (node->is_red()) {
+				std::cout << RED;
+			}
+			std::cout << "val : " << KeyOfValue()(node->val) << std::endl;
+			std::cout << "parent : ";
+			if (node->get_parent()) {
+				std::cout << KeyOfValue()(node->get_parent()->val) << std::endl;
+			}
+			else {
+				std::cout << "NIL" << std::endl;
+			}
+			std::cout << "left : ";
+			if (node->left == this->ghost_node_) {
+				std::cout << "GHOST" << std::endl;
+			}
+			else if (node->left != this->nil_node_) {
+				std::cout << KeyOfValue()(node->left->val) << std::endl;
+			}
+			else {
+				std::cout << "NIL" << std::endl;
+			}
+			std::cout << "right : ";
+			if (node->right == this->ghost_node_) {
+				std::cout << "GHOST" << std::endl;
+			}
+			else if (node->right != this->nil_node_) {
+				std::cout << KeyOfValue()(node->right->val) << std::endl;
+			}
+			else {
+				std::cout << "NIL" << std::endl;
+			}
+			std::cout << RESET;
+			print_rbt(node->left);
+			print_rbt(node->right);
+		}
+	};
+}
+
+#endif
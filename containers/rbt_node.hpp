@@ -2,22 +2,29 @@
 #define RBT_NODE_HPP
 
 #include <cstdlib>
+#include <stdint.h>
 
 namespace ft
 {
+	// The color is stored in the low bit of the parent pointer, nodes being
+	// at least pointer aligned this bit is always free.
 	template <class ValueType>
 	class rbt_node
 	{
 	public:
 		ValueType val;
-		bool is_red;
-		rbt_node* parent;
+
+	private:
+		uintptr_t parent_and_color_;
+
+		static uintptr_t const red_bit = 1;
+
+	public:
 		rbt_node* left;
 		rbt_node* right;
 
 		rbt_node() :
-			is_red(true),
-			parent(NULL),
+			parent_and_color_(red_bit),
 			left(NULL),
 			right(NULL)
 		{
@@ -25,8 +32,7 @@ namespace ft
 		}
 
 		rbt_node(rbt_node const& src) :
-			is_red(src.is_red),
-			parent(src.parent),
+			parent_and_color_(src.parent_and_color_),
 			left(src.left),
 			right(src.right)
 		{
@@ -40,19 +46,53 @@ namespace ft
 
 		rbt_node& operator=(rbt_node const& rhs)
 		{
-			this->is_red = rhs.is_red;
-			this->parent = rhs.parent;
+			this->parent_and_color_ = rhs.parent_and_color_;
 			this->left = rhs.left;
 			this->right = rhs.right;
 			return *this;
 		}
 
+		rbt_node* get_parent() const
+		{
+			return reinterpret_cast<rbt_node*>(this->parent_and_color_
+					& ~red_bit);
+		}
+
+		void set_parent(rbt_node* parent)
+		{
+			this->parent_and_color_ = reinterpret_cast<uintptr_t>(parent)
+				| (this->parent_and_color_ & red_bit);
+		}
+
+		// Sets both at once, on a node whose links were never initialized.
+		void set_parent_and_color(rbt_node* parent, bool is_red)
+		{
+			this->parent_and_color_ = reinterpret_cast<uintptr_t>(parent)
+				| (is_red ? red_bit : 0);
+		}
+
+		bool is_red() const
+		{
+			return (this->parent_and_color_ & red_bit) != 0;
+		}
+
+		void set_red(bool is_red)
+		{
+			if (is_red) {
+				this->parent_and_color_ |= red_bit;
+			}
+			else {
+				this->parent_and_color_ &= ~red_bit;
+			}
+		}
+
 		rbt_node* get_grand_parent() const
 		{
-			if (this->parent == NULL) {
+			rbt_node* parent = this->get_parent();
+			if (parent == NULL) {
 				return NULL;
 			}
-			return this->parent->parent;
+			return parent->get_parent();
 		}
 
 		rbt_node* get_uncle() const
@@ -61,7 +101,7 @@ namespace ft
 			if (grand_parent == NULL) {
 				return NULL;
 			}
-			if (grand_parent->left == this->parent) {
+			if (grand_parent->left == this->get_parent()) {
 				return grand_parent->right;
 			}
 			else {
@@ -69,6 +109,21 @@ namespace ft
 			}
 		}
 
+		// Leaf sentinel shared by every tree of this node type, zero
+		// initialized so black with NULL links. It is never written to, which
+		// lets subtrees move from a tree to another without relinking.
+		static rbt_node* get_nil()
+		{
+			static union
+			{
+				char raw[sizeof(rbt_node)];
+				long double align_long_double;
+				long long align_long_long;
+				void* align_pointer;
+			} nil;
+			return reinterpret_cast<rbt_node*>(nil.raw);
+		}
+
 		rbt_node* get_relative_max()
 		{
 			rbt_node* max = this;
@@ -3,6 +3,8 @@
 
 #include <iterator>
 
+#include "iterator_traits.hpp"
+
 namespace ft
 {
 	template <class Iterator>
@@ -10,11 +12,13 @@ namespace ft
 	{
 	public:
 		typedef Iterator iterator_type;
-		typedef typename Iterator::iterator_category iterator_category;
-		typedef typename Iterator::value_type value_type;
-		typedef typename Iterator::difference_type difference_type;
-		typedef typename Iterator::pointer pointer;
-		typedef typename Iterator::reference reference;
+		typedef typename ft::iterator_traits<Iterator>::iterator_category
+			iterator_category;
+		typedef typename ft::iterator_traits<Iterator>::value_type value_type;
+		typedef typename ft::iterator_traits<Iterator>::difference_type
+			difference_type;
+		typedef typename ft::iterator_traits<Iterator>::pointer pointer;
+		typedef typename ft::iterator_traits<Iterator>::reference reference;
 
 		reverse_iterator() :
 			iterator()
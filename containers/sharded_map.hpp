@@ -0,0 +1,440 @@
+#ifndef SHARDED_MAP_HPP
+#define SHARDED_MAP_HPP
+
+#include <pthread.h>
+#include <iterator>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <stdexcept>
+
+#include "less.hpp"
+#include "pair.hpp"
+#include "hash.hpp"
+#include "vector.hpp"
+#include "map.hpp"
+
+namespace ft
+{
+	// Keys are spread by hash over independently locked ft::map shards,
+	// single key operations lock one shard and readers share it. Iterating
+	// merges the shards in key order and must be done under a read_guard.
+	template < class Key, class T, class Compare = ft::less<Key>,
+			 class Hash = ft::hash<Key>,
+			 class Alloc = std::allocator< ft::pair<Key const, T> > >
+	class sharded_map
+	{
+	public:
+		typedef Key key_type;
+		typedef T mapped_type;
+		typedef ft::pair<key_type const, mapped_type> value_type;
+		typedef Compare key_compare;
+		typedef Hash hasher;
+		typedef Alloc allocator_type;
+		typedef typename allocator_type::const_reference const_reference;
+		typedef typename allocator_type::const_pointer const_pointer;
+		typedef ft::map<key_type, mapped_type, key_compare, allocator_type>
+			shard_type;
+		typedef typename shard_type::difference_type difference_type;
+		typedef typename shard_type::size_type size_type;
+		class const_iterator;
+		class read_guard;
+
+	protected:
+		struct shard
+		{
+			pthread_rwlock_t lock;
+			shard_type map;
+			// keeps the lock of the next shard on another cache line
+			char padding[64];
+
+			shard(key_compare const& comp, allocator_type const& alloc) :
+				map(comp, alloc)
+			{
+				if (pthread_rwlock_init(&this->lock, NULL) != 0) {
+					throw std::runtime_error("sharded_map::shard");
+				}
+				return;
+			}
+
+			~shard()
+			{
+				pthread_rwlock_destroy(&this->lock);
+				return;
+			}
+		};
+
+		typedef typename allocator_type::template rebind<shard>::other
+			shard_allocator_type;
+
+		class shared_lock
+		{
+		public:
+			explicit shared_lock(shard& s) :
+				shard_(s)
+			{
+				pthread_rwlock_rdlock(&this->shard_.lock);
+				return;
+			}
+
+			~shared_lock()
+			{
+				pthread_rwlock_unlock(&this->shard_.lock);
+				return;
+			}
+
+		private:
+			shard& shard_;
+
+			shared_lock(shared_lock const& src);
+			shared_lock& operator=(shared_lock const& rhs);
+		};
+
+		class exclusive_lock
+		{
+		public:
+			explicit exclusive_lock(shard& s) :
+				shard_(s)
+			{
+				pthread_rwlock_wrlock(&this->shard_.lock);
+				return;
+			}
+
+			~exclusive_lock()
+			{
+				pthread_rwlock_unlock(&this->shard_.lock);
+				return;
+			}
+
+		private:
+			shard& shard_;
+
+			exclusive_lock(exclusive_lock const& src);
+			exclusive_lock& operator=(exclusive_lock const& rhs);
+		};
+
+	public:
+		// Holds every shard read locked, in shard order, so that writers
+		// locking a single shard cannot deadlock with it.
+		class read_guard
+		{
+		public:
+			explicit read_guard(sharded_map const& map) :
+				map_(map)
+			{
+				for (size_type i = 0; i < this->map_.shard_count_; ++i) {
+					pthread_rwlock_rdlock(&this->map_.shards_[i].lock);
+				}
+				return;
+			}
+
+			~read_guard()
+			{
+				for (size_type i = this->map_.shard_count_; i > 0; --i) {
+					pthread_rwlock_unlock(&this->map_.shards_[i - 1].lock);
+				}
+				return;
+			}
+
+		private:
+			sharded_map const& map_;
+
+			read_guard(read_guard const& src);
+			read_guard& operator=(read_guard const& rhs);
+		};
+
+		class const_iterator
+		{
+		public:
+			typedef typename sharded_map::value_type value_type;
+			typedef typename sharded_map::difference_type difference_type;
+			typedef typename sharded_map::const_pointer pointer;
+			typedef typename sharded_map::const_reference reference;
+			typedef std::forward_iterator_tag iterator_category;
+
+			const_iterator() :
+				shards_(NULL),
+				shard_count_(0),
+				comp_(),
+				positions_(),
+				current_(0)
+			{
+				return;
+			}
+
+			const_iterator(shard* shards, size_type shard_count,
+					key_compare const& comp, bool is_end) :
+				shards_(shards),
+				shard_count_(shard_count),
+				comp_(comp),
+				positions_(),
+				current_(shard_count)
+			{
+				if (is_end == true) {
+					return;
+				}
+				this->positions_.reserve(shard_count);
+				for (size_type i = 0; i < shard_count; ++i) {
+					this->positions_.push_back(this->shards_[i].map.begin());
+				}
+				this->select_current();
+				return;
+			}
+
+			const_iterator(const_iterator const& src) :
+				shards_(src.shards_),
+				shard_count_(src.shard_count_),
+				comp_(src.comp_),
+				positions_(src.positions_),
+				current_(src.current_)
+			{
+				return;
+			}
+
+			~const_iterator()
+			{
+				return;
+			}
+
+			const_iterator& operator=(const_iterator const& rhs)
+			{
+				this->shards_ = rhs.shards_;
+				this->shard_count_ = rhs.shard_count_;
+				this->comp_ = rhs.comp_;
+				this->positions_ = rhs.positions_;
+				this->current_ = rhs.current_;
+				return *this;
+			}
+
+			bool operator==(const_iterator const& rhs) const
+			{
+				if (this->current_ != rhs.current_) {
+					return false;
+				}
+				return this->current_ == this->shard_count_
+					|| this->positions_[this->current_]
+					== rhs.positions_[rhs.current_];
+			}
+
+			bool operator!=(const_iterator const& rhs) const
+			{
+				return !(*this == rhs);
+			}
+
+			reference operator*() const
+			{
+				return *this->positions_[this->current_];
+			}
+
+			pointer operator->() const
+			{
+				return &*this->positions_[this->current_];
+			}
+
+			const_iterator& operator++()
+			{
+				++this->positions_[this->current_];
+				this->select_current();
+				return *this;
+			}
+
+			const_iterator operator++(int)
+			{
+				const_iterator tmp = *this;
+				++(*this);
+				return tmp;
+			}
+
+		private:
+			shard* shards_;
+			size_type shard_count_;
+			key_compare comp_;
+			ft::vector<typename shard_type::const_iterator> positions_;
+			size_type current_;
+
+			void select_current()
+			{
+				this->current_ = this->shard_count_;
+				for (size_type i = 0; i < this->shard_count_; ++i) {
+					if (this->positions_[i] == this->shards_[i].map.end()) {
+						continue;
+					}
+					if (this->current_ == this->shard_count_
+							|| this->comp_(this->positions_[i]->first,
+								this->positions_[this->current_]->first)
+							== true) {
+						this->current_ = i;
+					}
+				}
+				return;
+			}
+		};
+
+	protected:
+		key_compare comp_;
+		hasher hash_;
+		allocator_type alloc_;
+		shard_allocator_type shard_alloc_;
+		size_type shard_count_;
+		shard* shards_;
+
+	public:
+		explicit sharded_map(size_type shard_count = 16,
+				key_compare const& comp = key_compare(),
+				hasher const& hash = hasher(),
+				allocator_type const& alloc = allocator_type()) :
+			comp_(comp),
+			hash_(hash),
+			alloc_(alloc),
+			shard_alloc_(alloc),
+			shard_count_(shard_count == 0 ? 1 : shard_count),
+			shards_(this->shard_alloc_.allocate(this->shard_count_))
+		{
+			size_type constructed = 0;
+			try {
+				while (constructed < this->shard_count_) {
+					new (this->shards_ + constructed) shard(comp, alloc);
+					constructed++;
+				}
+			}
+			catch (...) {
+				while (constructed > 0) {
+					constructed--;
+					this->shards_[constructed].~shard();
+				}
+				this->shard_alloc_.deallocate(this->shards_, this->shard_count_);
+				throw;
+			}
+			return;
+		}
+
+		~sharded_map()
+		{
+			for (size_type i = 0; i < this->shard_count_; ++i) {
+				this->shards_[i].~shard();
+			}
+			this->shard_alloc_.deallocate(this->shards_, this->shard_count_);
+			return;
+		}
+
+		const_iterator begin() const
+		{
+			return const_iterator(this->shards_, this->shard_count_, this->comp_,
+					false);
+		}
+
+		const_iterator end() const
+		{
+			return const_iterator(this->shards_, this->shard_count_, this->comp_,
+					true);
+		}
+
+		bool empty() const
+		{
+			return this->size() == 0;
+		}
+
+		size_type size() const
+		{
+			size_type size = 0;
+			for (size_type i = 0; i < this->shard_count_; ++i) {
+				shared_lock lock(this->shards_[i]);
+				size += this->shards_[i].map.size();
+			}
+			return size;
+		}
+
+		size_type max_size() const
+		{
+			return this->shards_[0].map.max_size();
+		}
+
+		size_type shard_count() const
+		{
+			return this->shard_count_;
+		}
+
+		// Returns whether the key was found, copying its value to value.
+		bool find(key_type const& k, mapped_type& value) const
+		{
+			shard& s = this->get_shard(k);
+			shared_lock lock(s);
+			typename shard_type::const_iterator it = s.map.find(k);
+			if (it == s.map.end()) {
+				return false;
+			}
+			value = it->second;
+			return true;
+		}
+
+		size_type count(key_type const& k) const
+		{
+			shard& s = this->get_shard(k);
+			shared_lock lock(s);
+			return s.map.count(k);
+		}
+
+		bool insert(value_type const& val)
+		{
+			shard& s = this->get_shard(val.first);
+			exclusive_lock lock(s);
+			return s.map.insert(val).second;
+		}
+
+		// Inserts the value or replaces the mapped value of its key, returns
+		// whether it was inserted.
+		bool insert_or_assign(value_type const& val)
+		{
+			shard& s = this->get_shard(val.first);
+			exclusive_lock lock(s);
+			ft::pair<typename shard_type::iterator, bool> ret
+				= s.map.insert(val);
+			if (ret.second == false) {
+				ret.first->second = val.second;
+			}
+			return ret.second;
+		}
+
+		size_type erase(key_type const& k)
+		{
+			shard& s = this->get_shard(k);
+			exclusive_lock lock(s);
+			return s.map.erase(k);
+		}
+
+		void clear()
+		{
+			for (size_type i = 0; i < this->shard_count_; ++i) {
+				exclusive_lock lock(this->shards_[i]);
+				this->shards_[i].map.clear();
+			}
+			return;
+		}
+
+		key_compare key_comp() const
+		{
+			return this->comp_;
+		}
+
+		hasher hash_function() const
+		{
+			return this->hash_;
+		}
+
+		allocator_type get_allocator() const
+		{
+			return this->alloc_;
+		}
+
+	private:
+		sharded_map(sharded_map const& src);
+		sharded_map& operator=(sharded_map const& rhs);
+
+		shard& get_shard(key_type const& k) const
+		{
+			return this->shards_[this->hash_(k) % this->shard_count_];
+		}
+	};
+}
+
+#endif
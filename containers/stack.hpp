@@ -1,10 +1,33 @@
 #ifndef STACK_HPP
 #define STACK_HPP
 
+#include <iterator>
+#include <utility>
+
+#include "enable_if.hpp"
+#include "iterator_traits.hpp"
 #include "vector.hpp"
 
 namespace ft
 {
+	// Whether Container has a reserve(size_type) member.
+	template <class Container>
+	struct has_reserve
+	{
+		typedef char yes;
+		typedef char no[2];
+
+		template <class C, void (C::*)(typename C::size_type)>
+		struct check;
+
+		template <class C>
+		static yes& test(check<C, &C::reserve>*);
+		template <class C>
+		static no& test(...);
+
+		static bool const value = sizeof(test<Container>(NULL)) == sizeof(yes);
+	};
+
 	template < class T, class Container = vector<T> >
 	class stack;
 
@@ -87,11 +110,100 @@ namespace ft
 			return ctnr_.push_back(val);
 		}
 
+#if __cplusplus >= 201103L
+		void push(value_type&& val)
+		{
+			return ctnr_.push_back(std::move(val));
+		}
+
+		template <class... Args>
+		void emplace(Args&&... args)
+		{
+			return ctnr_.emplace_back(std::forward<Args>(args)...);
+		}
+#endif
+
 		void pop()
 		{
 			return ctnr_.pop_back();
 		}
 
+		// Reserves room for n elements when the container can, a vector
+		// then pushes up to n elements without reallocating.
+		void reserve(size_type n)
+		{
+			this->reserve_container<container_type>(n);
+			return;
+		}
+
+		// Pushes the range in order, the last element ending on top. A
+		// forward range is appended by one insert of the container, which
+		// sizes a vector once. When a push throws, the elements of the range
+		// already pushed are popped.
+		template <class InputIterator>
+		void push_range(InputIterator first, InputIterator last)
+		{
+			this->push_range(first, last,
+					typename ft::iterator_traits<InputIterator>::iterator_category());
+			return;
+		}
+
+		// Pops the n top elements with one erase of the container, n must not
+		// be greater than size().
+		void pop_n(size_type n)
+		{
+			typename container_type::iterator first = this->ctnr_.end();
+			std::advance(first, -static_cast<typename ft::iterator_traits<
+					typename container_type::iterator>::difference_type>(n));
+			this->ctnr_.erase(first, this->ctnr_.end());
+			return;
+		}
+
+	protected:
+		template <class InputIterator>
+		void push_range(InputIterator first, InputIterator last,
+				std::input_iterator_tag)
+		{
+			size_type old_size = this->ctnr_.size();
+			try {
+				while (first != last) {
+					this->ctnr_.push_back(*first);
+					++first;
+				}
+			}
+			catch (...) {
+				while (this->ctnr_.size() > old_size) {
+					this->ctnr_.pop_back();
+				}
+				throw;
+			}
+			return;
+		}
+
+		template <class ForwardIterator>
+		void push_range(ForwardIterator first, ForwardIterator last,
+				std::forward_iterator_tag)
+		{
+			this->ctnr_.insert(this->ctnr_.end(), first, last);
+			return;
+		}
+
+		template <class C>
+		typename ft::enable_if<ft::has_reserve<C>::value>::type
+		reserve_container(size_type n)
+		{
+			this->ctnr_.reserve(n);
+			return;
+		}
+
+		template <class C>
+		typename ft::enable_if<!ft::has_reserve<C>::value>::type
+		reserve_container(size_type)
+		{
+			return;
+		}
+
+	public:
 		friend bool operator== <T, Container>(stack const& lhs, stack const& rhs);
 		friend bool operator!= <T, Container>(stack const& lhs, stack const& rhs);
 		friend bool operator< <T, Container>(stack const& lhs, stack const& rhs);
@@ -0,0 +1,439 @@
+#ifndef STATIC_VECTOR_HPP
+#define STATIC_VECTOR_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <sstream>
+#include <utility>
+
+#include "enable_if.hpp"
+#include "reverse_iterator.hpp"
+#include "iterator_traits.hpp"
+#include "comparaison.hpp"
+
+namespace ft
+{
+	// Vector of at most N elements stored inline, which never allocates.
+	// Growing past N throws std::length_error. Its iterators are pointers.
+	template <class T, std::size_t N>
+	class static_vector
+	{
+	public:
+		typedef T value_type;
+		typedef T& reference;
+		typedef T const& const_reference;
+		typedef T* pointer;
+		typedef T const* const_pointer;
+		typedef pointer iterator;
+		typedef const_pointer const_iterator;
+		typedef ft::reverse_iterator<iterator> reverse_iterator;
+		typedef ft::reverse_iterator<const_iterator> const_reverse_iterator;
+		typedef std::ptrdiff_t difference_type;
+		typedef std::size_t size_type;
+
+	protected:
+		size_type size_;
+		char storage_[N * sizeof(T)] __attribute__((aligned(__alignof__(T))));
+
+	public:
+		static_vector() :
+			size_(0)
+		{
+			return;
+		}
+
+		explicit static_vector(size_type n, value_type const& val = value_type()) :
+			size_(0)
+		{
+			this->assign(n, val);
+			return;
+		}
+
+		template <class InputIterator>
+		static_vector(InputIterator first, InputIterator last,
+				typename ft::enable_if<!ft::is_integral<InputIterator>::value,
+				bool>::type = true) :
+			size_(0)
+		{
+			this->assign(first, last);
+			return;
+		}
+
+		static_vector(static_vector const& x) :
+			size_(0)
+		{
+			this->assign(x.begin(), x.end());
+			return;
+		}
+
+		~static_vector()
+		{
+			this->clear();
+			return;
+		}
+
+		static_vector& operator=(static_vector const& x)
+		{
+			if (this != &x) {
+				this->assign(x.begin(), x.end());
+			}
+			return *this;
+		}
+
+#if __cplusplus >= 201103L
+		static_vector(static_vector&& x) :
+			size_(0)
+		{
+			for (iterator it = x.begin(); it != x.end(); ++it) {
+				this->emplace_back(std::move(*it));
+			}
+			return;
+		}
+
+		static_vector& operator=(static_vector&& x)
+		{
+			if (this != &x) {
+				this->clear();
+				for (iterator it = x.begin(); it != x.end(); ++it) {
+					this->emplace_back(std::move(*it));
+				}
+			}
+			return *this;
+		}
+#endif
+
+		iterator begin()
+		{
+			return this->data();
+		}
+
+		const_iterator begin() const
+		{
+			return this->data();
+		}
+
+		iterator end()
+		{
+			return this->data() + this->size_;
+		}
+
+		const_iterator end() const
+		{
+			return this->data() + this->size_;
+		}
+
+		reverse_iterator rbegin()
+		{
+			return reverse_iterator(this->end());
+		}
+
+		const_reverse_iterator rbegin() const
+		{
+			return const_reverse_iterator(this->end());
+		}
+
+		reverse_iterator rend()
+		{
+			return reverse_iterator(this->begin());
+		}
+
+		const_reverse_iterator rend() const
+		{
+			return const_reverse_iterator(this->begin());
+		}
+
+		size_type size() const
+		{
+			return this->size_;
+		}
+
+		size_type max_size() const
+		{
+			return N;
+		}
+
+		size_type capacity() const
+		{
+			return N;
+		}
+
+		bool empty() const
+		{
+			return this->size_ == 0;
+		}
+
+		bool full() const
+		{
+			return this->size_ == N;
+		}
+
+		void resize(size_type n, value_type val = value_type())
+		{
+			while (this->size_ > n) {
+				this->pop_back();
+			}
+			while (this->size_ < n) {
+				this->push_back(val);
+			}
+			return;
+		}
+
+		reference operator[](size_type n)
+		{
+			return this->data()[n];
+		}
+
+		const_reference operator[](size_type n) const
+		{
+			return this->data()[n];
+		}
+
+		reference at(size_type n)
+		{
+			this->range_check(n);
+			return this->data()[n];
+		}
+
+		const_reference at(size_type n) const
+		{
+			this->range_check(n);
+			return this->data()[n];
+		}
+
+		reference front()
+		{
+			return this->data()[0];
+		}
+
+		const_reference front() const
+		{
+			return this->data()[0];
+		}
+
+		reference back()
+		{
+			return this->data()[this->size_ - 1];
+		}
+
+		const_reference back() const
+		{
+			return this->data()[this->size_ - 1];
+		}
+
+		pointer data()
+		{
+			return reinterpret_cast<pointer>(this->storage_);
+		}
+
+		const_pointer data() const
+		{
+			return reinterpret_cast<const_pointer>(this->storage_);
+		}
+
+		template <class InputIterator>
+		void assign(InputIterator first, InputIterator last,
+				typename ft::enable_if<!ft::is_integral<InputIterator>::value,
+				bool>::type = true)
+		{
+			this->clear();
+			while (first != last) {
+				this->push_back(*first);
+				++first;
+			}
+			return;
+		}
+
+		void assign(size_type n, value_type const& val)
+		{
+			if (n > N) {
+				throw std::length_error("static_vector::assign");
+			}
+			this->clear();
+			while (this->size_ < n) {
+				this->push_back(val);
+			}
+			return;
+		}
+
+		void push_back(value_type const& val)
+		{
+			if (this->size_ == N) {
+				throw std::length_error("static_vector::push_back");
+			}
+			new (this->data() + this->size_) value_type(val);
+			this->size_++;
+			return;
+		}
+
+#if __cplusplus >= 201103L
+		void push_back(value_type&& val)
+		{
+			this->emplace_back(std::move(val));
+			return;
+		}
+
+		template <class... Args>
+		void emplace_back(Args&&... args)
+		{
+			if (this->size_ == N) {
+				throw std::length_error("static_vector::emplace_back");
+			}
+			new (this->data() + this->size_) value_type(std::forward<Args>(args)...);
+			this->size_++;
+			return;
+		}
+#endif
+
+		void pop_back()
+		{
+			this->size_--;
+			(this->data() + this->size_)->~value_type();
+			return;
+		}
+
+		// Appends the range then rotates it into place. A range that does not
+		// fit throws std::length_error and inserts nothing: a forward range is
+		// measured first, the appended elements of an input range are popped.
+		template <class InputIterator>
+		void insert(iterator position, InputIterator first, InputIterator last,
+				typename ft::enable_if<!ft::is_integral<InputIterator>::value,
+				bool>::type = true)
+		{
+			this->insert_range(position, first, last,
+					typename ft::iterator_traits<InputIterator>::iterator_category());
+			return;
+		}
+
+		iterator erase(iterator position)
+		{
+			return this->erase(position, position + 1);
+		}
+
+		iterator erase(iterator first, iterator last)
+		{
+			iterator new_end = std::copy(last, this->end(), first);
+			while (this->end() != new_end) {
+				this->pop_back();
+			}
+			return first;
+		}
+
+		void swap(static_vector& x)
+		{
+			static_vector tmp(x);
+			x = *this;
+			*this = tmp;
+			return;
+		}
+
+		void clear()
+		{
+			while (this->size_ > 0) {
+				this->pop_back();
+			}
+			return;
+		}
+
+	protected:
+		template <class InputIterator>
+		void insert_range(iterator position, InputIterator first,
+				InputIterator last, std::input_iterator_tag)
+		{
+			difference_type index = position - this->begin();
+			size_type old_size = this->size_;
+			try {
+				while (first != last) {
+					this->push_back(*first);
+					++first;
+				}
+			}
+			catch (...) {
+				while (this->size_ > old_size) {
+					this->pop_back();
+				}
+				throw;
+			}
+			std::rotate(this->begin() + index, this->begin() + old_size,
+					this->end());
+			return;
+		}
+
+		template <class ForwardIterator>
+		void insert_range(iterator position, ForwardIterator first,
+				ForwardIterator last, std::forward_iterator_tag)
+		{
+			if (static_cast<size_type>(std::distance(first, last))
+					> N - this->size_) {
+				throw std::length_error("static_vector::insert");
+			}
+			this->insert_range(position, first, last, std::input_iterator_tag());
+			return;
+		}
+
+		void range_check(size_type n) const
+		{
+			if (n >= this->size_) {
+				std::ostringstream oss;
+				oss << "static_vector::range_check: n (which is " << n
+					<< ") >= this->size() (which is " << this->size_ << ")";
+				throw std::out_of_range(oss.str());
+			}
+			return;
+		}
+	};
+
+	template <class T, std::size_t N>
+	bool operator==(static_vector<T,N> const& lhs, static_vector<T,N> const& rhs)
+	{
+		if (lhs.size() != rhs.size()) {
+			return false;
+		}
+		return ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+	}
+
+	template <class T, std::size_t N>
+	bool operator!=(static_vector<T,N> const& lhs, static_vector<T,N> const& rhs)
+	{
+		return !(lhs == rhs);
+	}
+
+	template <class T, std::size_t N>
+	bool operator<(static_vector<T,N> const& lhs, static_vector<T,N> const& rhs)
+	{
+		return ft::lexicographical_compare_three_way(lhs.begin(), lhs.end(),
+				rhs.begin(), rhs.end()) < 0;
+	}
+
+	template <class T, std::size_t N>
+	bool operator<=(static_vector<T,N> const& lhs, static_vector<T,N> const& rhs)
+	{
+		return ft::lexicographical_compare_three_way(lhs.begin(), lhs.end(),
+				rhs.begin(), rhs.end()) <= 0;
+	}
+
+	template <class T, std::size_t N>
+	bool operator>(static_vector<T,N> const& lhs, static_vector<T,N> const& rhs)
+	{
+		return ft::lexicographical_compare_three_way(lhs.begin(), lhs.end(),
+				rhs.begin(), rhs.end()) > 0;
+	}
+
+	template <class T, std::size_t N>
+	bool operator>=(static_vector<T,N> const& lhs, static_vector<T,N> const& rhs)
+	{
+		return ft::lexicographical_compare_three_way(lhs.begin(), lhs.end(),
+				rhs.begin(), rhs.end()) >= 0;
+	}
+
+	template <class T, std::size_t N>
+	void swap(static_vector<T,N>& x, static_vector<T,N>& y)
+	{
+		x.swap(y);
+		return;
+	}
+}
+
+#endif
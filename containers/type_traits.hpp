@@ -0,0 +1,138 @@
+#ifndef TYPE_TRAITS_HPP
+#define TYPE_TRAITS_HPP
+
+#include <memory>
+#include <utility>
+
+#include "enable_if.hpp"
+
+#if defined(__clang__) && defined(__has_builtin)
+# if __has_builtin(__is_trivially_copyable) \
+	&& __has_builtin(__is_trivially_destructible)
+#  define FT_TRIVIALLY_COPYABLE(T) __is_trivially_copyable(T)
+#  define FT_TRIVIALLY_DESTRUCTIBLE(T) __is_trivially_destructible(T)
+# endif
+#elif defined(__GNUC__) && __GNUC__ >= 5
+# define FT_TRIVIALLY_COPYABLE(T) __is_trivially_copyable(T)
+# define FT_TRIVIALLY_DESTRUCTIBLE(T) __has_trivial_destructor(T)
+#endif
+
+namespace ft
+{
+	template<class T>
+	struct is_floating_point
+	{
+		static bool const value = false;
+	};
+	template<>
+	struct is_floating_point<float>
+	{
+		static bool const value = true;
+	};
+	template<>
+	struct is_floating_point<double>
+	{
+		static bool const value = true;
+	};
+	template<>
+	struct is_floating_point<long double>
+	{
+		static bool const value = true;
+	};
+
+	template<class T>
+	struct is_pointer
+	{
+		static bool const value = false;
+	};
+	template<class T>
+	struct is_pointer<T*>
+	{
+		static bool const value = true;
+	};
+
+	template<class T>
+	struct is_arithmetic
+	{
+		static bool const value = ft::is_integral<T>::value
+			|| ft::is_floating_point<T>::value;
+	};
+
+	// Without the compiler builtins, only the arithmetic and pointer types
+	// are known to be trivial.
+	template<class T>
+	struct is_trivially_destructible
+	{
+#if defined(FT_TRIVIALLY_DESTRUCTIBLE)
+		static bool const value = FT_TRIVIALLY_DESTRUCTIBLE(T);
+#else
+		static bool const value = ft::is_arithmetic<T>::value
+			|| ft::is_pointer<T>::value;
+#endif
+	};
+
+	// A copy of a T is a copy of its bytes, the containers then copy and
+	// fill with memcpy and memset. Specialize it for the types the builtins
+	// can not see through.
+	template<class T>
+	struct is_bitwise_copyable
+	{
+#if defined(FT_TRIVIALLY_COPYABLE)
+		static bool const value = FT_TRIVIALLY_COPYABLE(T);
+#else
+		static bool const value = ft::is_arithmetic<T>::value
+			|| ft::is_pointer<T>::value;
+#endif
+	};
+
+	// A T moved to other bytes and not destroyed at its old address is
+	// valid, the containers then relocate with memcpy and memmove. True of
+	// most types holding no pointer into themselves, like ft::vector. It
+	// can be specialized for them, not for libstdc++ std::string which
+	// points into its own buffer.
+	template<class T>
+	struct is_trivially_relocatable
+	{
+		static bool const value = ft::is_bitwise_copyable<T>::value
+			&& ft::is_trivially_destructible<T>::value;
+	};
+
+	// Whether Alloc is the std::allocator of T, whose construct and destroy
+	// only copy and destroy. The containers only skip them for it, a user
+	// allocator sees a call for each element.
+	template<class Alloc, class T>
+	struct is_default_allocator
+	{
+		static bool const value = false;
+	};
+
+	template<class T>
+	struct is_default_allocator<std::allocator<T>, T>
+	{
+		static bool const value = true;
+	};
+
+	template<class T>
+	struct is_trivially_relocatable< std::allocator<T> >
+	{
+		static bool const value = true;
+	};
+
+	// val as an rvalue when it has a move constructor that can not throw,
+	// for the relocations to move without losing the strong guarantee.
+#if __cplusplus >= 201103L
+	template<class T>
+	auto move_if_noexcept(T& val) -> decltype(std::move_if_noexcept(val))
+	{
+		return std::move_if_noexcept(val);
+	}
+#else
+	template<class T>
+	T const& move_if_noexcept(T& val)
+	{
+		return val;
+	}
+#endif
+}
+
+#endif
@@ -0,0 +1,277 @@
+#ifndef UNORDERED_SET_HPP
+#define UNORDERED_SET_HPP
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+#include "pair.hpp"
+#include "hash.hpp"
+#include "equal_to.hpp"
+#include "key_of_value.hpp"
+#include "hash_table.hpp"
+
+namespace ft
+{
+	template < class T, class Hash = ft::hash<T>,
+			 class KeyEqual = ft::equal_to<T>, class Alloc = std::allocator<T> >
+	class unordered_set
+	{
+	public:
+		typedef T key_type;
+		typedef T value_type;
+		typedef Hash hasher;
+		typedef KeyEqual key_equal;
+		typedef Alloc allocator_type;
+		typedef typename allocator_type::reference reference;
+		typedef typename allocator_type::const_reference const_reference;
+		typedef typename allocator_type::pointer pointer;
+		typedef typename allocator_type::const_pointer const_pointer;
+
+	protected:
+		typedef ft::hash_table<key_type, value_type,
+				ft::identity<value_type>, hasher, key_equal, allocator_type>
+			table_type;
+
+	public:
+		typedef typename table_type::const_iterator const_iterator;
+		typedef const_iterator iterator;
+		typedef typename table_type::difference_type difference_type;
+		typedef typename table_type::size_type size_type;
+
+	protected:
+		table_type table_;
+
+	public:
+		explicit unordered_set(size_type bucket_count = 0,
+				hasher const& hash = hasher(),
+				key_equal const& equal = key_equal(),
+				allocator_type const& alloc = allocator_type()) :
+			table_(hash, equal, alloc)
+		{
+			if (bucket_count != 0) {
+				this->table_.rehash(bucket_count);
+			}
+			return;
+		}
+
+		template <class InputIterator>
+		unordered_set(InputIterator first, InputIterator last,
+				size_type bucket_count = 0,
+				hasher const& hash = hasher(),
+				key_equal const& equal = key_equal(),
+				allocator_type const& alloc = allocator_type()) :
+			table_(hash, equal, alloc)
+		{
+			if (bucket_count != 0) {
+				this->table_.rehash(bucket_count);
+			}
+			this->insert(first, last);
+			return;
+		}
+
+		unordered_set(unordered_set const& x) :
+			table_(x.table_)
+		{
+			return;
+		}
+
+		~unordered_set()
+		{
+			return;
+		}
+
+		unordered_set& operator=(unordered_set const& x)
+		{
+			this->table_ = x.table_;
+			return *this;
+		}
+
+#if __cplusplus >= 201103L
+		unordered_set(unordered_set&& x) :
+			table_(std::move(x.table_))
+		{
+			return;
+		}
+
+		unordered_set& operator=(unordered_set&& x)
+		{
+			this->table_ = std::move(x.table_);
+			return *this;
+		}
+#endif
+
+		const_iterator begin() const
+		{
+			return this->table_.begin();
+		}
+
+		const_iterator end() const
+		{
+			return this->table_.end();
+		}
+
+		bool empty() const
+		{
+			return this->table_.empty();
+		}
+
+		size_type size() const
+		{
+			return this->table_.size();
+		}
+
+		size_type max_size() const
+		{
+			return this->table_.max_size();
+		}
+
+		ft::pair<iterator,bool> insert(value_type const& val)
+		{
+			ft::pair<typename table_type::iterator,bool> result
+				= this->table_.insert_unique(val);
+			return ft::pair<iterator,bool>(result.first, result.second);
+		}
+
+		iterator insert(const_iterator position, value_type const& val)
+		{
+			static_cast<void>(position);
+			return this->table_.insert_unique(val).first;
+		}
+
+		template <class InputIterator>
+		void insert(InputIterator first, InputIterator last)
+		{
+			this->table_.insert_unique(first, last);
+			return;
+		}
+
+		void erase(const_iterator position)
+		{
+			this->table_.erase(position);
+			return;
+		}
+
+		size_type erase(key_type const& k)
+		{
+			return this->table_.erase_unique(k);
+		}
+
+		void erase(const_iterator first, const_iterator last)
+		{
+			this->table_.erase(first, last);
+			return;
+		}
+
+		void swap(unordered_set& x)
+		{
+			this->table_.swap(x.table_);
+			return;
+		}
+
+		void clear()
+		{
+			this->table_.clear();
+			return;
+		}
+
+		hasher hash_function() const
+		{
+			return this->table_.hash_function();
+		}
+
+		key_equal key_eq() const
+		{
+			return this->table_.key_eq();
+		}
+
+		const_iterator find(key_type const& k) const
+		{
+			return this->table_.find(k);
+		}
+
+		size_type count(key_type const& k) const
+		{
+			return this->table_.count(k);
+		}
+
+		pair<const_iterator,const_iterator> equal_range(key_type const& k) const
+		{
+			return this->table_.equal_range(k);
+		}
+
+		size_type bucket_count() const
+		{
+			return this->table_.bucket_count();
+		}
+
+		float load_factor() const
+		{
+			return this->table_.load_factor();
+		}
+
+		float max_load_factor() const
+		{
+			return this->table_.max_load_factor();
+		}
+
+		void max_load_factor(float ml)
+		{
+			this->table_.max_load_factor(ml);
+			return;
+		}
+
+		void rehash(size_type n)
+		{
+			this->table_.rehash(n);
+			return;
+		}
+
+		void reserve(size_type n)
+		{
+			this->table_.reserve(n);
+			return;
+		}
+
+		allocator_type get_allocator() const
+		{
+			return this->table_.get_allocator();
+		}
+	};
+
+	template< class T, class Hash, class KeyEqual, class Alloc >
+	bool operator==(ft::unordered_set<T,Hash,KeyEqual,Alloc> const& lhs,
+			ft::unordered_set<T,Hash,KeyEqual,Alloc> const& rhs)
+	{
+		if (lhs.size() != rhs.size()) {
+			return false;
+		}
+		typedef typename ft::unordered_set<T,Hash,KeyEqual,Alloc>
+			::const_iterator const_iterator;
+		for (const_iterator cit = lhs.begin(), cite = lhs.end(); cit != cite;
+				++cit) {
+			const_iterator found = rhs.find(*cit);
+			if (found == rhs.end() || !(*found == *cit)) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	template< class T, class Hash, class KeyEqual, class Alloc >
+	bool operator!=(ft::unordered_set<T,Hash,KeyEqual,Alloc> const& lhs,
+			ft::unordered_set<T,Hash,KeyEqual,Alloc> const& rhs)
+	{
+		return !(lhs == rhs);
+	}
+
+	template< class T, class Hash, class KeyEqual, class Alloc >
+	void swap(ft::unordered_set<T,Hash,KeyEqual,Alloc>& lhs,
+			ft::unordered_set<T,Hash,KeyEqual,Alloc>& rhs)
+	{
+		lhs.swap(rhs);
+		return;
+	}
+}
+
+#endif
@@ -2,13 +2,16 @@
 #define VECTOR_HPP
 
 #include <cstddef>
+#include <cstring>
 #include <iostream>
 #include <iterator>
 #include <memory>
 #include <stdexcept>
 #include <sstream>
+#include <utility>
 
 #include "enable_if.hpp"
+#include "type_traits.hpp"
 #include "reverse_iterator.hpp"
 #include "iterator_traits.hpp"
 #include "comparaison.hpp"
@@ -40,6 +43,7 @@ namespace ft
 			typedef pointer pointer;
 			typedef typename ft::iterator_traits<pointer>::reference reference;
 			typedef std::random_access_iterator_tag iterator_category;
+			typedef ft::contiguous_iterator_tag iterator_concept;
 
 			pointer ptr_;
 
@@ -185,6 +189,7 @@ namespace ft
 			typedef const_pointer pointer;
 			typedef typename ft::iterator_traits<const_pointer>::reference reference;
 			typedef std::random_access_iterator_tag iterator_category;
+			typedef ft::contiguous_iterator_tag iterator_concept;
 
 			pointer ptr_;
 
@@ -345,9 +350,7 @@ namespace ft
 			capacity_(n),
 			array_(this->alloc_.allocate(this->capacity_))
 		{
-			for (size_type i = 0; i < n; i++) {
-				this->alloc_.construct(this->array_ + i, val);
-			}
+			this->construct_fill(this->array_, n, val);
 			return;
 		}
 
@@ -365,12 +368,7 @@ namespace ft
 			this->size_ = size;
 			this->capacity_ = size;
 			this->array_ = this->alloc_.allocate(this->capacity_);
-			pointer it = this->array_;
-			while (first != last) {
-				this->alloc_.construct(it, *first);
-				it++;
-				first++;
-			}
+			this->construct_range(this->array_, first, last);
 			return;
 		}
 
@@ -380,9 +378,7 @@ namespace ft
 			capacity_(x.size_),
 			array_(this->alloc_.allocate(this->capacity_))
 		{
-			for (size_type i = 0, size = x.size_; i < size; ++i) {
-				this->alloc_.construct(this->array_ + i, x.array_[i]);
-			}
+			this->construct_range(this->array_, x.array_, x.array_ + x.size_);
 			return;
 		}
 
@@ -401,11 +397,38 @@ namespace ft
 				this->array_ = this->alloc_.allocate(this->capacity_);
 			}
 			this->size_ = x.size_;
-			for (size_type i = 0, size = x.size_; i < size; ++i) {
-				this->alloc_.construct(this->array_ + i, x.array_[i]);
+			this->construct_range(this->array_, x.array_, x.array_ + x.size_);
+			return *this;
+		}
+
+#if __cplusplus >= 201103L
+		vector(vector&& x) :
+			alloc_(x.alloc_),
+			size_(x.size_),
+			capacity_(x.capacity_),
+			array_(x.array_)
+		{
+			x.size_ = 0;
+			x.capacity_ = 0;
+			x.array_ = NULL;
+			return;
+		}
+
+		vector& operator=(vector&& x)
+		{
+			if (this != &x) {
+				this->clear();
+				this->alloc_.deallocate(this->array_, this->capacity_);
+				this->size_ = x.size_;
+				this->capacity_ = x.capacity_;
+				this->array_ = x.array_;
+				x.size_ = 0;
+				x.capacity_ = 0;
+				x.array_ = NULL;
 			}
 			return *this;
 		}
+#endif
 
 		iterator begin()
 		{
@@ -488,12 +511,7 @@ namespace ft
 			}
 			pointer old = this->array_;
 			this->array_ = this->alloc_.allocate(n);
-			for (pointer it = this->array_,
-					old_it = old, old_ite = old + this->size_;
-					old_it != old_ite; ++it, ++old_it) {
-				this->alloc_.construct(it, *old_it);
-				this->alloc_.destroy(old_it);
-			}
+			this->relocate(this->array_, old, old + this->size_);
 			this->alloc_.deallocate(old, this->capacity_);
 			this->capacity_ = n;
 			return;
@@ -564,12 +582,7 @@ namespace ft
 				this->capacity_ = size;
 				this->array_ = this->alloc_.allocate(this->capacity_);
 			}
-			pointer it = this->array_;
-			while (first != last) {
-				this->alloc_.construct(it, *first);
-				it++;
-				first++;
-			}
+			this->construct_range(this->array_, first, last);
 			return;
 		}
 
@@ -582,9 +595,7 @@ namespace ft
 				this->capacity_ = n;
 				this->array_ = this->alloc_.allocate(this->capacity_);
 			}
-			for (size_type i = 0; i < n; ++i) {
-				this->alloc_.construct(this->array_ + i, val);
-			}
+			this->construct_fill(this->array_, n, val);
 			return;
 		}
 
@@ -601,6 +612,29 @@ namespace ft
 			return;
 		}
 
+#if __cplusplus >= 201103L
+		void push_back(value_type&& val)
+		{
+			this->emplace_back(std::move(val));
+			return;
+		}
+
+		template <class... Args>
+		void emplace_back(Args&&... args)
+		{
+			if (this->capacity_ == 0) {
+				this->reserve(1);
+			}
+			else if (this->size_ == this->capacity_) {
+				this->reserve(this->capacity_ * 2);
+			}
+			std::allocator_traits<allocator_type>::construct(this->alloc_,
+					this->array_ + this->size_, std::forward<Args>(args)...);
+			this->size_++;
+			return;
+		}
+#endif
+
 		void pop_back()
 		{
 			this->size_--;
@@ -617,11 +651,8 @@ namespace ft
 			else if (this->size_ == this->capacity_) {
 				this->reserve(this->capacity_ * 2);
 			}
-			for (pointer it = this->array_ + this->size_,
-					ite = this->array_ + index; it != ite; --it) {
-				this->alloc_.construct(it, *(it - 1));
-				this->alloc_.destroy(it - 1);
-			}
+			this->relocate(this->array_ + index + 1, this->array_ + index,
+					this->array_ + this->size_);
 			this->alloc_.construct(this->array_ + index, val);
 			this->size_++;
 			return iterator(this->array_ + index);
@@ -640,16 +671,10 @@ namespace ft
 			else if (this->size_ + n > this->capacity_) {
 				this->reserve(this->size_ * 2);
 			}
-			for (pointer it = this->array_ + this->size_ - 1 + n,
-					ite = this->array_ + index - 1 + n; it != ite; --it) {
-				this->alloc_.construct(it, *(it - n));
-				this->alloc_.destroy(it - n);
-			}
+			this->relocate(this->array_ + index + n, this->array_ + index,
+					this->array_ + this->size_);
 			this->size_ += n;
-			while (n > 0) {
-				this->alloc_.construct(this->array_ + index - 1 + n, val);
-				n--;
-			}
+			this->construct_fill(this->array_ + index, n, val);
 			return;
 		}
 
@@ -670,28 +695,18 @@ namespace ft
 			else if (this->size_ + n > this->capacity_) {
 				this->reserve(this->size_ * 2);
 			}
-			for (pointer it = this->array_ + this->size_ - 1 + n,
-					ite = this->array_ + index - 1 + n; it != ite; --it) {
-				this->alloc_.construct(it, *(it - n));
-				this->alloc_.destroy(it - n);
-			}
+			this->relocate(this->array_ + index + n, this->array_ + index,
+					this->array_ + this->size_);
 			this->size_ += n;
-			while (n > 0) {
-				last--;
-				this->alloc_.construct(this->array_ + index - 1 + n, *last);
-				n--;
-			}
+			this->construct_range(this->array_ + index, first, last);
 			return;
 		}
 
 		iterator erase(iterator position)
 		{
 			this->alloc_.destroy(position.ptr_);
-			for (pointer it = position.ptr_, ite = this->end().ptr_ - 1;
-					it != ite; ++it) {
-				this->alloc_.construct(it, *(it + 1));
-				this->alloc_.destroy(it + 1);
-			}
+			this->relocate(position.ptr_, position.ptr_ + 1,
+					this->array_ + this->size_);
 			this->size_--;
 			return position;
 		}
@@ -702,17 +717,9 @@ namespace ft
 				return first;
 			}
 
-			size_type n = 0;
-			for (pointer it = first.ptr_; it != last.ptr_; ++it) {
-				this->alloc_.destroy(first.ptr_);
-				n++;
-			}
-			for (pointer it = first.ptr_, ite = this->end().ptr_ - n;
-					it != ite; ++it) {
-				this->alloc_.construct(it, *(it + n));
-				this->alloc_.destroy(it + n);
-			}
-			this->size_ -= n;
+			this->destroy_range(first.ptr_, last.ptr_);
+			this->relocate(first.ptr_, last.ptr_, this->array_ + this->size_);
+			this->size_ -= last.ptr_ - first.ptr_;
 			return first;
 		}
 
@@ -732,9 +739,7 @@ namespace ft
 
 		void clear()
 		{
-			for (size_type i = 0, size = this->size_; i < size; ++i) {
-				this->alloc_.destroy(this->array_ + i);
-			}
+			this->destroy_range(this->array_, this->array_ + this->size_);
 			this->size_ = 0;
 			return;
 		}
@@ -760,8 +765,151 @@ namespace ft
 			}
 			return size;
 		}
+
+		// With the default allocator, the contiguous ranges of a bitwise
+		// copyable value_type are copied with a single memcpy, their elements
+		// need no construct call. Reversed contiguous ranges are copied from
+		// their raw pointers.
+		template <class InputIterator>
+		typename ft::enable_if<!(ft::is_bitwise_copy_compatible<InputIterator,
+			pointer>::value && ft::is_default_allocator<Alloc, T>::value)
+			&& ft::contiguous_iterator_traits<InputIterator>::reversed
+			== false>::type
+		construct_range(pointer dest, InputIterator first, InputIterator last)
+		{
+			while (first != last) {
+				this->alloc_.construct(dest, *first);
+				++dest;
+				++first;
+			}
+			return;
+		}
+
+		template <class InputIterator>
+		typename ft::enable_if<ft::is_bitwise_copy_compatible<InputIterator,
+			pointer>::value && ft::is_default_allocator<Alloc, T>::value>::type
+		construct_range(pointer dest, InputIterator first, InputIterator last)
+		{
+			typedef ft::contiguous_iterator_traits<InputIterator> traits;
+			if (first != last) {
+				std::memcpy(static_cast<void*>(dest), traits::address(first),
+						(traits::address(last) - traits::address(first))
+						* sizeof(value_type));
+			}
+			return;
+		}
+
+		template <class InputIterator>
+		typename ft::enable_if<ft::contiguous_iterator_traits<
+			InputIterator>::reversed>::type
+		construct_range(pointer dest, InputIterator first, InputIterator last)
+		{
+			typedef ft::contiguous_iterator_traits<InputIterator> traits;
+			typename traits::pointer it = traits::address(first);
+			typename traits::pointer ite = traits::address(last);
+			while (it != ite) {
+				this->alloc_.construct(dest, *traits::next(it));
+				++dest;
+			}
+			return;
+		}
+
+		// With the default allocator, byte sized bitwise copyable values are
+		// filled with memset.
+		template <class U>
+		typename ft::enable_if<!(ft::is_bitwise_copyable<U>::value
+			&& sizeof(U) == 1
+			&& ft::is_default_allocator<Alloc, T>::value)>::type
+		construct_fill(U* dest, size_type n, U const& val)
+		{
+			for (size_type i = 0; i < n; ++i) {
+				this->alloc_.construct(dest + i, val);
+			}
+			return;
+		}
+
+		template <class U>
+		typename ft::enable_if<ft::is_bitwise_copyable<U>::value
+			&& sizeof(U) == 1
+			&& ft::is_default_allocator<Alloc, T>::value>::type
+		construct_fill(U* dest, size_type n, U const& val)
+		{
+			unsigned char byte;
+			std::memcpy(&byte, &val, 1);
+			std::memset(dest, byte, n);
+			return;
+		}
+
+		template <class U>
+		typename ft::enable_if<!(ft::is_trivially_destructible<U>::value
+			&& ft::is_default_allocator<Alloc, T>::value)>::type
+		destroy_range(U* first, U* last)
+		{
+			while (first != last) {
+				this->alloc_.destroy(first);
+				++first;
+			}
+			return;
+		}
+
+		template <class U>
+		typename ft::enable_if<ft::is_trivially_destructible<U>::value
+			&& ft::is_default_allocator<Alloc, T>::value>::type
+		destroy_range(U*, U*)
+		{
+			return;
+		}
+
+		// Moves [first, last) to dest, which may overlap it, and leaves
+		// [first, last) destroyed. With the default allocator, trivially
+		// relocatable values are moved with a single memmove, the others are
+		// moved in C++11 when that can not throw.
+		template <class U>
+		typename ft::enable_if<!(ft::is_trivially_relocatable<U>::value
+			&& ft::is_default_allocator<Alloc, T>::value)>::type
+		relocate(U* dest, U* first, U* last)
+		{
+			if (dest < first) {
+				for (; first != last; ++first, ++dest) {
+					this->alloc_.construct(dest,
+							ft::move_if_noexcept(*first));
+					this->alloc_.destroy(first);
+				}
+			}
+			else if (dest > first) {
+				for (dest += last - first; first != last; ) {
+					--last;
+					--dest;
+					this->alloc_.construct(dest,
+							ft::move_if_noexcept(*last));
+					this->alloc_.destroy(last);
+				}
+			}
+			return;
+		}
+
+		template <class U>
+		typename ft::enable_if<ft::is_trivially_relocatable<U>::value
+			&& ft::is_default_allocator<Alloc, T>::value>::type
+		relocate(U* dest, U* first, U* last)
+		{
+			if (first != last) {
+				std::memmove(static_cast<void*>(dest), first,
+						(last - first) * sizeof(U));
+			}
+			return;
+		}
+	};
+
+	// ft::vector points to its elements, never into itself.
+	template <class T, class Alloc>
+	struct is_trivially_relocatable< ft::vector<T,Alloc> >
+	{
+		static bool const value = ft::is_trivially_relocatable<Alloc>::value;
 	};
 
+	// Compared through contiguous iterators, which reach the memcmp paths
+	// of the integral types.
 	template <class T, class Alloc>
 	bool operator==(vector<T,Alloc> const& lhs, vector<T,Alloc> const& rhs)
 	{
@@ -780,26 +928,29 @@ namespace ft
 	template <class T, class Alloc>
 	bool operator<(vector<T,Alloc> const& lhs, vector<T,Alloc> const& rhs)
 	{
-		return ft::lexicographical_compare(lhs.begin(), lhs.end(),
-				rhs.begin(), rhs.end());
+		return ft::lexicographical_compare_three_way(lhs.begin(),
+				lhs.end(), rhs.begin(), rhs.end()) < 0;
 	}
 
 	template <class T, class Alloc>
 	bool operator<=(vector<T,Alloc> const& lhs, vector<T,Alloc> const& rhs)
 	{
-		return !(rhs < lhs);
+		return ft::lexicographical_compare_three_way(lhs.begin(),
+				lhs.end(), rhs.begin(), rhs.end()) <= 0;
 	}
 
 	template <class T, class Alloc>
 	bool operator>(vector<T,Alloc> const& lhs, vector<T,Alloc> const& rhs)
 	{
-		return rhs < lhs;
+		return ft::lexicographical_compare_three_way(lhs.begin(),
+				lhs.end(), rhs.begin(), rhs.end()) > 0;
 	}
 
 	template <class T, class Alloc>
 	bool operator>=(vector<T,Alloc> const& lhs, vector<T,Alloc> const& rhs)
 	{
-		return !(lhs < rhs);
+		return ft::lexicographical_compare_three_way(lhs.begin(),
+				lhs.end(), rhs.begin(), rhs.end()) >= 0;
 	}
 
 	template <class T, class Alloc>
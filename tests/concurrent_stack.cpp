@@ -0,0 +1,198 @@
+#include <sys/time.h>
+#include <pthread.h>
+#include <iostream>
+#include <string>
+
+#include "tests.hpp"
+
+#if IS_FT
+# include "concurrent_stack.hpp"
+# define CONCURRENT_STACK ft::concurrent_stack
+#else
+# include <stack>
+
+namespace tests { namespace concurrent_stack
+{
+	// single mutex std::stack with the concurrent_stack interface
+	template <class T>
+	class locked_stack
+	{
+	public:
+		typedef T value_type;
+		typedef typename std::stack<T>::size_type size_type;
+
+		locked_stack()
+		{
+			pthread_mutex_init(&this->mutex_, NULL);
+		}
+
+		~locked_stack()
+		{
+			pthread_mutex_destroy(&this->mutex_);
+		}
+
+		bool empty() const { return this->stack_.empty(); }
+		size_type size() const { return this->stack_.size(); }
+		T top() const { return this->stack_.top(); }
+
+		void push(T const& val)
+		{
+			pthread_mutex_lock(&this->mutex_);
+			this->stack_.push(val);
+			pthread_mutex_unlock(&this->mutex_);
+		}
+
+		void pop()
+		{
+			pthread_mutex_lock(&this->mutex_);
+			if (this->stack_.empty() == false) {
+				this->stack_.pop();
+			}
+			pthread_mutex_unlock(&this->mutex_);
+		}
+
+		bool try_pop(T& val)
+		{
+			pthread_mutex_lock(&this->mutex_);
+			bool popped = this->stack_.empty() == false;
+			if (popped == true) {
+				val = this->stack_.top();
+				this->stack_.pop();
+			}
+			pthread_mutex_unlock(&this->mutex_);
+			return popped;
+		}
+
+	private:
+		pthread_mutex_t mutex_;
+		std::stack<T> stack_;
+	};
+} }
+
+# define CONCURRENT_STACK tests::concurrent_stack::locked_stack
+#endif
+
+namespace tests { namespace concurrent_stack
+{
+	typedef CONCURRENT_STACK<int> int_stack;
+
+	int const nb_elems = 20000;
+	int const nb_threads = 4;
+
+	void modifiers()
+	{
+		std::cout << "modifiers tests :\n";
+
+		CONCURRENT_STACK<std::string> stack;
+		std::cout << "- empty : " << std::boolalpha << stack.empty()
+			<< ", size " << stack.size() << "\n";
+		stack.push("first");
+		stack.push("second");
+		stack.push("third");
+		std::cout << "- push, top : " << stack.top() << ", size "
+			<< stack.size() << "\n";
+		stack.pop();
+		std::string val;
+		bool popped = stack.try_pop(val);
+		std::cout << "- pop and try_pop : " << popped << " " << val
+			<< ", top : " << stack.top() << ", size " << stack.size() << "\n";
+		stack.pop();
+		stack.pop();
+		popped = stack.try_pop(val);
+		std::cout << "- pop and try_pop on empty : " << popped << " " << val
+			<< ", empty : " << stack.empty() << "\n";
+		for (int i = 0; i < 100; ++i) {
+			stack.push(std::string(i, 'x'));
+		}
+		std::cout << "- push reusing popped nodes, top size : "
+			<< stack.top().size() << ", size " << stack.size() << "\n";
+
+		std::cout << std::flush;
+	}
+
+	struct thread_arg
+	{
+		int_stack* stack;
+		int index;
+		long long popped_sum;
+	};
+
+	void* push_and_pop(void* arg)
+	{
+		thread_arg* targ = static_cast<thread_arg*>(arg);
+		targ->popped_sum = 0;
+		for (int i = targ->index; i < nb_elems; i += nb_threads) {
+			targ->stack->push(i);
+			targ->stack->push(-i);
+			int val = 0;
+			if (targ->stack->try_pop(val) == true) {
+				targ->popped_sum += val;
+			}
+		}
+		return NULL;
+	}
+
+	void threads()
+	{
+		std::cout << "threads tests :\n";
+
+		int_stack stack;
+		pthread_t threads[nb_threads];
+		thread_arg args[nb_threads];
+		int started = 0;
+		for (int i = 0; i < nb_threads; ++i) {
+			args[i].stack = &stack;
+			args[i].index = i;
+			if (pthread_create(&threads[i], NULL, &push_and_pop, &args[i])
+					!= 0) {
+				break;
+			}
+			started++;
+		}
+		for (int i = 0; i < started; ++i) {
+			pthread_join(threads[i], NULL);
+		}
+		for (int i = started; i < nb_threads; ++i) {
+			push_and_pop(&args[i]);
+		}
+		long long sum = 0;
+		for (int i = 0; i < nb_threads; ++i) {
+			sum += args[i].popped_sum;
+		}
+		std::cout << "- concurrent push and try_pop, size " << stack.size();
+		int remaining = 0;
+		int val = 0;
+		while (stack.try_pop(val) == true) {
+			sum += val;
+			remaining++;
+		}
+		std::cout << ", remaining " << remaining << ", sum of all popped "
+			<< sum << ", empty " << std::boolalpha << stack.empty() << "\n";
+
+		std::cout << std::flush;
+	}
+
+	void launch()
+	{
+		struct timeval	timeval;
+
+		if (gettimeofday(&timeval, NULL) == -1) {
+			std::cout << "gettimeofday failed" << std::endl;
+			return;
+		}
+		unsigned long long time_start = timeval.tv_sec * 1000000 + timeval.tv_usec;
+
+		modifiers();
+		std::cout << "\n";
+		threads();
+
+		if (gettimeofday(&timeval, NULL) == -1) {
+			std::cout << "gettimeofday failed" << std::endl;
+			return;
+		}
+		unsigned long long time_end = timeval.tv_sec * 1000000 + timeval.tv_usec;
+
+		std::cout << "\nTests duration : " << time_end - time_start
+			<< " microseconds" << std::endl;
+	}
+} }
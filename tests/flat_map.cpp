@@ -0,0 +1,317 @@
+#include <sys/time.h>
+#include <iostream>
+#include <string>
+
+#include "tests.hpp"
+
+#if IS_FT
+# include "flat_map.hpp"
+# define FLAT_MAP ft::flat_map
+#else
+# include <map>
+# define FLAT_MAP std::map
+#endif
+
+namespace tests { namespace flat_map
+{
+	typedef FLAT_MAP<int, int> int_map;
+
+	int const nb_elems = 5000;
+
+	int shuffled_key(int i)
+	{
+		return (i * 7919) % nb_elems;
+	}
+
+	void print_summary(int_map const& map)
+	{
+		long long sum = 0;
+		for (int_map::const_iterator cit = map.begin(), cite = map.end();
+				cit != cite; ++cit) {
+			sum += cit->first * 3 + cit->second;
+		}
+		std::cout << " size " << map.size() << ", sum " << sum;
+		if (map.empty() == false) {
+			std::cout << ", front [" << map.begin()->first << ", "
+				<< map.begin()->second << "], back [" << map.rbegin()->first
+				<< ", " << map.rbegin()->second << "]";
+		}
+		std::cout << "\n";
+	}
+
+	void constructors()
+	{
+		std::cout << "Constructors tests :\n";
+
+		int_map default_map;
+		std::cout << "- default constructor, empty() : " << std::boolalpha
+			<< default_map.empty() << ", begin() == end() : "
+			<< (default_map.begin() == default_map.end()) << "\n";
+
+		int_map util;
+		for (int i = 0; i < nb_elems; ++i) {
+			util[shuffled_key(i)] = i;
+		}
+		int_map range(++util.begin(), --util.end());
+		std::cout << "- range constructor :";
+		print_summary(range);
+
+		int_map copy(util);
+		std::cout << "- copy constructor :";
+		print_summary(copy);
+
+		copy = range;
+		std::cout << "- assignment operator :";
+		print_summary(copy);
+
+		std::cout << std::flush;
+	}
+
+	void iterators()
+	{
+		std::cout << "iterators tests :\n";
+
+		int_map map;
+		for (int i = 0; i < nb_elems; ++i) {
+			map[shuffled_key(i)] = i;
+		}
+
+		int previous = -1;
+		bool sorted = true;
+		int count = 0;
+		for (int_map::iterator it = map.begin(), ite = map.end(); it != ite;
+				++it) {
+			sorted = sorted && previous < it->first;
+			previous = it->first;
+			count++;
+		}
+		std::cout << "- forward iteration sorted : " << std::boolalpha
+			<< sorted << ", count : " << count << "\n";
+
+		previous = nb_elems;
+		sorted = true;
+		count = 0;
+		for (int_map::reverse_iterator rit = map.rbegin(), rite = map.rend();
+				rit != rite; ++rit) {
+			sorted = sorted && rit->first < previous;
+			previous = rit->first;
+			count++;
+		}
+		std::cout << "- reverse iteration sorted : " << std::boolalpha
+			<< sorted << ", count : " << count << "\n";
+
+		int_map::iterator it = map.end();
+		--it;
+		--it;
+		it->second = 42;
+		std::cout << "- --(--end()) : [" << it->first << ", " << it->second
+			<< "], ++ : [" << (++it)->first << "]\n";
+
+		std::cout << std::flush;
+	}
+
+	void insert()
+	{
+		std::cout << "insert tests :\n";
+
+		int_map map;
+		int inserted = 0;
+		for (int i = 0; i < nb_elems; ++i) {
+			inserted += map.insert(NAMESPACE::make_pair(shuffled_key(i) / 2, i))
+				.second;
+		}
+		std::cout << "- single element inserts, inserted : " << inserted
+			<< ",";
+		print_summary(map);
+
+		int_map::iterator it = map.insert(map.end(),
+				NAMESPACE::make_pair(nb_elems, 1));
+		std::cout << "- hint insert return : [" << it->first << ", "
+			<< it->second << "]\n";
+
+		int_map sequential;
+		for (int i = 0; i < nb_elems; ++i) {
+			sequential.insert(sequential.end(), NAMESPACE::make_pair(i, -i));
+		}
+		for (int i = 0; i < nb_elems; ++i) {
+			sequential.insert(NAMESPACE::make_pair(-i - 1, i));
+		}
+		std::cout << "- sequential inserts :";
+		print_summary(sequential);
+
+		map.insert(sequential.begin(), sequential.end());
+		std::cout << "- range insert :";
+		print_summary(map);
+
+		NAMESPACE::pair<int, int> unsorted[nb_elems];
+		for (int i = 0; i < nb_elems; ++i) {
+			unsorted[i] = NAMESPACE::make_pair(shuffled_key(i) / 4, i);
+		}
+#if IS_FT
+		map.build(unsorted, unsorted + nb_elems);
+#else
+		map.clear();
+		map.insert(unsorted, unsorted + nb_elems);
+#endif
+		std::cout << "- build from unsorted values with duplicates :";
+		print_summary(map);
+
+		FLAT_MAP<std::string, std::string> strings;
+		strings["b"] = "second";
+		strings["a"] = "first";
+		strings["c"] = "last";
+		strings["b"] += " !";
+		std::cout << "- operator[] values :";
+		for (FLAT_MAP<std::string, std::string>::const_iterator
+				cit = strings.begin(), cite = strings.end(); cit != cite; ++cit) {
+			std::cout << " [" << cit->first << ", " << cit->second << "]";
+		}
+		std::cout << "\n";
+
+		std::cout << std::flush;
+	}
+
+	void erase()
+	{
+		std::cout << "erase tests :\n";
+
+		int_map map;
+		for (int i = 0; i < nb_elems; ++i) {
+			map[shuffled_key(i)] = i;
+		}
+
+		int erased = 0;
+		for (int i = 0; i < nb_elems; i += 3) {
+			erased += map.erase(shuffled_key(i));
+		}
+		erased += map.erase(-1);
+		std::cout << "- key erase, erased : " << erased << ",";
+		print_summary(map);
+
+		while (map.size() > static_cast<int_map::size_type>(nb_elems / 2)) {
+			map.erase(map.begin());
+			map.erase(--map.end());
+		}
+		std::cout << "- iterator erase :";
+		print_summary(map);
+
+		map.erase(map.lower_bound(nb_elems / 4), map.upper_bound(nb_elems / 2));
+		std::cout << "- range erase :";
+		print_summary(map);
+
+		map.erase(map.begin(), map.end());
+		std::cout << "- full range erase :";
+		print_summary(map);
+
+		for (int i = 0; i < nb_elems; ++i) {
+			map[i] = i;
+		}
+		map.clear();
+		std::cout << "- clear :";
+		print_summary(map);
+
+		std::cout << std::flush;
+	}
+
+	void lookup()
+	{
+		std::cout << "lookup tests :\n";
+
+		int_map map;
+		for (int i = 0; i < nb_elems; i += 2) {
+			map[shuffled_key(i)] = i;
+		}
+		int found = 0;
+		int counted = 0;
+		for (int i = 0; i < nb_elems; ++i) {
+			found += map.find(i) != map.end();
+			counted += map.count(i);
+		}
+		std::cout << "- find, found : " << found << ", count : " << counted
+			<< "\n";
+
+		int_map const& cmap = map;
+		std::cout << "- lower_bound :";
+		for (int k = -1; k < 10; ++k) {
+			int_map::const_iterator cit = cmap.lower_bound(k);
+			std::cout << " " << cit->first;
+		}
+		std::cout << "\n- upper_bound :";
+		for (int k = -1; k < 10; ++k) {
+			int_map::iterator it = map.upper_bound(k);
+			std::cout << " " << it->first;
+		}
+		std::cout << "\n- bounds past the end : " << std::boolalpha
+			<< (map.lower_bound(nb_elems) == map.end()) << " "
+			<< (map.upper_bound(nb_elems) == map.end()) << "\n";
+
+		NAMESPACE::pair<int_map::iterator, int_map::iterator> range;
+		std::cout << "- equal_range :";
+		for (int k = 0; k < 6; ++k) {
+			range = map.equal_range(k);
+			std::cout << " [" << range.first->first << ", "
+				<< range.second->first << "]";
+		}
+		std::cout << "\n";
+
+		std::cout << std::flush;
+	}
+
+	void relational_operators()
+	{
+		std::cout << "relational operators tests :\n";
+
+		int_map lhs;
+		int_map rhs;
+		for (int i = 0; i < nb_elems; ++i) {
+			lhs[i] = i;
+			rhs[i] = i;
+		}
+		std::cout << "- equal maps : " << std::boolalpha << (lhs == rhs)
+			<< " " << (lhs != rhs) << " " << (lhs < rhs) << " " << (lhs <= rhs)
+			<< " " << (lhs > rhs) << " " << (lhs >= rhs) << "\n";
+		rhs[nb_elems / 2] = -1;
+		std::cout << "- different maps : " << std::boolalpha << (lhs == rhs)
+			<< " " << (lhs != rhs) << " " << (lhs < rhs) << " " << (lhs <= rhs)
+			<< " " << (lhs > rhs) << " " << (lhs >= rhs) << "\n";
+
+		lhs.swap(rhs);
+		std::cout << "- after swap, lhs[" << nb_elems / 2 << "] : "
+			<< lhs[nb_elems / 2] << ", rhs[" << nb_elems / 2 << "] : "
+			<< rhs[nb_elems / 2] << "\n";
+
+		std::cout << std::flush;
+	}
+
+	void launch()
+	{
+		struct timeval	timeval;
+
+		if (gettimeofday(&timeval, NULL) == -1) {
+			std::cout << "gettimeofday failed" << std::endl;
+			return;
+		}
+		unsigned long long time_start = timeval.tv_sec * 1000000 + timeval.tv_usec;
+
+		constructors();
+		std::cout << "\n";
+		iterators();
+		std::cout << "\n";
+		insert();
+		std::cout << "\n";
+		erase();
+		std::cout << "\n";
+		lookup();
+		std::cout << "\n";
+		relational_operators();
+
+		if (gettimeofday(&timeval, NULL) == -1) {
+			std::cout << "gettimeofday failed" << std::endl;
+			return;
+		}
+		unsigned long long time_end = timeval.tv_sec * 1000000 + timeval.tv_usec;
+
+		std::cout << "\nTests duration : " << time_end - time_start
+			<< " microseconds" << std::endl;
+	}
+} }
@@ -0,0 +1,200 @@
+#include <sys/time.h>
+#include <iostream>
+#include <string>
+
+#include "tests.hpp"
+
+#if IS_FT
+# include "flat_set.hpp"
+# define FLAT_SET ft::flat_set
+#else
+# include <set>
+# define FLAT_SET std::set
+#endif
+
+namespace tests { namespace flat_set
+{
+	typedef FLAT_SET<int> int_set;
+
+	int const nb_elems = 5000;
+
+	int shuffled_key(int i)
+	{
+		return (i * 7919) % nb_elems;
+	}
+
+	void print_summary(int_set const& set)
+	{
+		long long sum = 0;
+		int previous = -nb_elems - 1;
+		bool sorted = true;
+		for (int_set::const_iterator cit = set.begin(), cite = set.end();
+				cit != cite; ++cit) {
+			sum += *cit;
+			sorted = sorted && previous < *cit;
+			previous = *cit;
+		}
+		std::cout << " size " << set.size() << ", sum " << sum << ", sorted "
+			<< std::boolalpha << sorted;
+		if (set.empty() == false) {
+			std::cout << ", front " << *set.begin() << ", back "
+				<< *set.rbegin();
+		}
+		std::cout << "\n";
+	}
+
+	void constructors()
+	{
+		std::cout << "Constructors tests :\n";
+
+		int_set default_set;
+		std::cout << "- default constructor :";
+		print_summary(default_set);
+
+		int_set util;
+		for (int i = 0; i < nb_elems; ++i) {
+			util.insert(shuffled_key(i));
+		}
+		int_set range(++util.begin(), --util.end());
+		std::cout << "- range constructor :";
+		print_summary(range);
+
+		int_set copy(util);
+		std::cout << "- copy constructor :";
+		print_summary(copy);
+
+		copy = range;
+		std::cout << "- assignment operator :";
+		print_summary(copy);
+
+		std::cout << std::flush;
+	}
+
+	void modifiers()
+	{
+		std::cout << "modifiers tests :\n";
+
+		int_set set;
+		int inserted = 0;
+		for (int i = 0; i < nb_elems; ++i) {
+			inserted += set.insert(shuffled_key(i) / 3).second;
+		}
+		std::cout << "- insert, inserted : " << inserted << ",";
+		print_summary(set);
+
+		for (int i = 0; i < nb_elems; ++i) {
+			set.insert(set.begin(), -i);
+		}
+		std::cout << "- hint insert :";
+		print_summary(set);
+
+		int erased = 0;
+		for (int i = -nb_elems; i < nb_elems; i += 2) {
+			erased += set.erase(i);
+		}
+		std::cout << "- key erase, erased : " << erased << ",";
+		print_summary(set);
+
+		set.erase(set.find(1));
+		set.erase(set.begin());
+		std::cout << "- iterator erase :";
+		print_summary(set);
+
+		set.erase(set.lower_bound(-nb_elems / 2), set.upper_bound(nb_elems / 8));
+		std::cout << "- range erase :";
+		print_summary(set);
+
+		int_set other;
+		other.insert(42);
+		set.swap(other);
+		std::cout << "- swap :";
+		print_summary(set);
+
+		other.clear();
+		std::cout << "- clear :";
+		print_summary(other);
+
+		int unsorted[nb_elems];
+		for (int i = 0; i < nb_elems; ++i) {
+			unsorted[i] = shuffled_key(i) / 4;
+		}
+#if IS_FT
+		set.build(unsorted, unsorted + nb_elems);
+#else
+		set.clear();
+		set.insert(unsorted, unsorted + nb_elems);
+#endif
+		std::cout << "- build from unsorted values with duplicates :";
+		print_summary(set);
+
+		std::cout << std::flush;
+	}
+
+	void lookup()
+	{
+		std::cout << "lookup tests :\n";
+
+		FLAT_SET<std::string> set;
+		for (int i = 0; i < nb_elems; ++i) {
+			set.insert(std::string(1, 'a' + i % 26) + std::string(i % 7, 'z'));
+		}
+		std::cout << "- size : " << set.size() << ", count(\"bzz\") : "
+			<< set.count("bzz") << ", count(\"b\") : " << set.count("b")
+			<< ", find(\"mzzzz\") : " << *set.find("mzzzz") << "\n";
+		std::cout << "- lower_bound(\"c\") : " << *set.lower_bound("c")
+			<< ", upper_bound(\"c\") : " << *set.upper_bound("c")
+			<< ", equal_range(\"q\") : " << *set.equal_range("q").first
+			<< " " << *set.equal_range("q").second << "\n";
+
+		std::cout << std::flush;
+	}
+
+	void relational_operators()
+	{
+		std::cout << "relational operators tests :\n";
+
+		int_set lhs;
+		int_set rhs;
+		for (int i = 0; i < nb_elems; ++i) {
+			lhs.insert(i);
+			rhs.insert(i);
+		}
+		std::cout << "- equal sets : " << std::boolalpha << (lhs == rhs)
+			<< " " << (lhs != rhs) << " " << (lhs < rhs) << " " << (lhs <= rhs)
+			<< " " << (lhs > rhs) << " " << (lhs >= rhs) << "\n";
+		rhs.erase(nb_elems / 2);
+		std::cout << "- different sets : " << std::boolalpha << (lhs == rhs)
+			<< " " << (lhs != rhs) << " " << (lhs < rhs) << " " << (lhs <= rhs)
+			<< " " << (lhs > rhs) << " " << (lhs >= rhs) << "\n";
+
+		std::cout << std::flush;
+	}
+
+	void launch()
+	{
+		struct timeval	timeval;
+
+		if (gettimeofday(&timeval, NULL) == -1) {
+			std::cout << "gettimeofday failed" << std::endl;
+			return;
+		}
+		unsigned long long time_start = timeval.tv_sec * 1000000 + timeval.tv_usec;
+
+		constructors();
+		std::cout << "\n";
+		modifiers();
+		std::cout << "\n";
+		lookup();
+		std::cout << "\n";
+		relational_operators();
+
+		if (gettimeofday(&timeval, NULL) == -1) {
+			std::cout << "gettimeofday failed" << std::endl;
+			return;
+		}
+		unsigned long long time_end = timeval.tv_sec * 1000000 + timeval.tv_usec;
+
+		std::cout << "\nTests duration : " << time_end - time_start
+			<< " microseconds" << std::endl;
+	}
+} }
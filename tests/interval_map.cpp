@@ -0,0 +1,210 @@
+#include <sys/time.h>
+#include <iostream>
+
+#include "tests.hpp"
+
+#if IS_FT
+# include "interval_map.hpp"
+# define INTERVAL_MAP ft::interval_map<int, int>
+#else
+# include <map>
+# define INTERVAL_MAP std::multimap<std::pair<int, int>, int>
+#endif
+
+namespace tests { namespace interval_map
+{
+	typedef INTERVAL_MAP int_interval_map;
+
+	int const nb_elems = 3000;
+
+	struct sum_mapped
+	{
+		int count;
+		long long sum;
+
+		sum_mapped() :
+			count(0),
+			sum(0)
+		{
+			return;
+		}
+
+		void operator()(int_interval_map::value_type const& val)
+		{
+			this->count++;
+			this->sum = this->sum * 31 % 1000000007 + val.second;
+		}
+	};
+
+	sum_mapped for_each_overlap(int_interval_map const& im, int low, int high)
+	{
+#if IS_FT
+		return im.for_each_overlap(low, high, sum_mapped());
+#else
+		sum_mapped fn;
+		for (int_interval_map::const_iterator cit = im.begin();
+				cit != im.end() && cit->first.first < high; ++cit) {
+			if (low < cit->first.second) {
+				fn(*cit);
+			}
+		}
+		return fn;
+#endif
+	}
+
+	sum_mapped for_each_containing(int_interval_map const& im, int point)
+	{
+#if IS_FT
+		return im.for_each_containing(point, sum_mapped());
+#else
+		sum_mapped fn;
+		for (int_interval_map::const_iterator cit = im.begin();
+				cit != im.end() && cit->first.first <= point; ++cit) {
+			if (point < cit->first.second) {
+				fn(*cit);
+			}
+		}
+		return fn;
+#endif
+	}
+
+	int find_overlap(int_interval_map const& im, int low, int high)
+	{
+#if IS_FT
+		int_interval_map::const_iterator cit = im.find_overlap(low, high);
+#else
+		int_interval_map::const_iterator cit = im.begin();
+		while (cit != im.end() && cit->first.first < high
+				&& (low < cit->first.second) == false) {
+			++cit;
+		}
+		if (cit != im.end() && (cit->first.first < high) == false) {
+			cit = im.end();
+		}
+#endif
+		if (cit == im.end()) {
+			return -1;
+		}
+		return cit->second;
+	}
+
+	void print_interval_map(int_interval_map const& im, int max_printed)
+	{
+		std::cout << " size " << im.size() << " :";
+		int printed = 0;
+		for (int_interval_map::const_iterator cit = im.begin(), cite = im.end();
+				cit != cite && printed < max_printed; ++cit, ++printed) {
+			std::cout << " [" << cit->first.first << ", " << cit->first.second
+				<< "):" << cit->second;
+		}
+		std::cout << "\n";
+	}
+
+	void modifiers()
+	{
+		std::cout << "modifiers tests :\n";
+
+		int_interval_map im;
+		for (int i = 0; i < nb_elems; ++i) {
+			int low = (i * 7919) % 1000;
+			im.insert(NAMESPACE::make_pair(NAMESPACE::make_pair(low,
+							low + 1 + i % 40), i));
+		}
+		im.insert(NAMESPACE::make_pair(NAMESPACE::make_pair(0, 1), -1));
+		std::cout << "- insert :";
+		print_interval_map(im, 6);
+
+		int_interval_map copy(im);
+		std::cout << "- interval erase, erased : "
+			<< im.erase(NAMESPACE::make_pair(0, 1)) << ", "
+			<< im.erase(NAMESPACE::make_pair(0, 2)) << ",";
+		print_interval_map(im, 6);
+
+		int_interval_map::iterator first = im.begin();
+		++first;
+		int_interval_map::iterator last = first;
+		for (int i = 0; i < 500; ++i) {
+			++last;
+		}
+		im.erase(first, last);
+		im.erase(im.begin());
+		std::cout << "- iterator and range erase :";
+		print_interval_map(im, 6);
+
+		std::cout << "- copy, (im == copy) : " << std::boolalpha
+			<< (im == copy) << ", (im > copy) : " << (im > copy) << ",";
+		print_interval_map(copy, 6);
+
+		im.swap(copy);
+		copy.clear();
+		std::cout << "- swap and clear, copy.empty() : " << copy.empty() << ",";
+		print_interval_map(im, 3);
+
+		std::cout << std::flush;
+	}
+
+	void queries()
+	{
+		std::cout << "queries tests :\n";
+
+		int_interval_map im;
+		for (int i = 0; i < nb_elems; ++i) {
+			int low = (i * 7919) % 10000;
+			im.insert(NAMESPACE::make_pair(NAMESPACE::make_pair(low,
+							low + 1 + (i * 31) % 200), i));
+		}
+		for (int i = 0; i < nb_elems; i += 3) {
+			im.erase(im.find(NAMESPACE::make_pair((i * 7919) % 10000,
+							(i * 7919) % 10000 + 1 + (i * 31) % 200)));
+		}
+		im.insert(NAMESPACE::make_pair(NAMESPACE::make_pair(-500, 20000), -1));
+
+		int const bounds[][2] = { { 0, 1 }, { 150, 400 }, { 5000, 5001 },
+			{ 9990, 12000 }, { -1000, -500 }, { 20000, 30000 }, { 0, 10000 } };
+		for (int i = 0; i < 7; ++i) {
+			sum_mapped fn = for_each_overlap(im, bounds[i][0], bounds[i][1]);
+			std::cout << "- overlap [" << bounds[i][0] << ", " << bounds[i][1]
+				<< ") count : " << fn.count << ", hash : " << fn.sum
+				<< ", first : " << find_overlap(im, bounds[i][0], bounds[i][1])
+				<< "\n";
+		}
+		int const points[] = { -501, -500, 0, 4242, 9999, 19999, 20000 };
+		for (int i = 0; i < 7; ++i) {
+			sum_mapped fn = for_each_containing(im, points[i]);
+			std::cout << "- containing " << points[i] << " count : " << fn.count
+				<< ", hash : " << fn.sum << "\n";
+		}
+		im.erase(NAMESPACE::make_pair(-500, 20000));
+		std::cout << "- first overlaps after erase :";
+		for (int i = 0; i < 7; ++i) {
+			std::cout << " " << find_overlap(im, bounds[i][0], bounds[i][1]);
+		}
+		std::cout << "\n";
+
+		std::cout << std::flush;
+	}
+
+	void launch()
+	{
+		struct timeval	timeval;
+
+		if (gettimeofday(&timeval, NULL) == -1) {
+			std::cout << "gettimeofday failed" << std::endl;
+			return;
+		}
+		unsigned long long time_start = timeval.tv_sec * 1000000 + timeval.tv_usec;
+
+		modifiers();
+		std::cout << "\n";
+		queries();
+
+		if (gettimeofday(&timeval, NULL) == -1) {
+			std::cout << "gettimeofday failed" << std::endl;
+			return;
+		}
+		unsigned long long time_end = timeval.tv_sec * 1000000 + timeval.tv_usec;
+
+		std::cout << "\nTests duration : " << time_end - time_start
+			<< " microseconds" << std::endl;
+	}
+} }
@@ -1,8 +1,10 @@
 #include <sys/time.h>
 #include <iostream>
 #include <list>
+#include <vector>
 
 #include "list.hpp"
+#include "vector.hpp"
 
 namespace tests { namespace list
 {
@@ -70,6 +72,17 @@ namespace tests { namespace list
 		}
 		std::cout << "\n";
 
+		NAMESPACE::vector<int> vec(util.begin(), util.end());
+		NAMESPACE::list<int> reversed(vec.rbegin(), vec.rend());
+		reversed.insert(++reversed.begin(), vec.rbegin(), vec.rbegin() + 2);
+		std::cout << "- range constructor and insert from reversed vector,"
+			" values :";
+		for (NAMESPACE::list<int>::const_iterator cit = reversed.begin(),
+				cite = reversed.end(); cit != cite; ++cit) {
+			std::cout << " " << *cit;
+		}
+		std::cout << "\n";
+
 		std::cout << std::flush;
 	}
 
@@ -31,6 +31,45 @@ int main(int argc, char* argv[])
 		else if (strcmp(argv[i], "set") == 0) {
 			tests::set::launch();
 		}
+		else if (strcmp(argv[i], "btree_map") == 0) {
+			tests::btree_map::launch();
+		}
+		else if (strcmp(argv[i], "btree_set") == 0) {
+			tests::btree_set::launch();
+		}
+		else if (strcmp(argv[i], "flat_map") == 0) {
+			tests::flat_map::launch();
+		}
+		else if (strcmp(argv[i], "flat_set") == 0) {
+			tests::flat_set::launch();
+		}
+		else if (strcmp(argv[i], "sharded_map") == 0) {
+			tests::sharded_map::launch();
+		}
+		else if (strcmp(argv[i], "persistent_map") == 0) {
+			tests::persistent_map::launch();
+		}
+		else if (strcmp(argv[i], "unordered_map") == 0) {
+			tests::unordered_map::launch();
+		}
+		else if (strcmp(argv[i], "unordered_set") == 0) {
+			tests::unordered_set::launch();
+		}
+		else if (strcmp(argv[i], "multimap") == 0) {
+			tests::multimap::launch();
+		}
+		else if (strcmp(argv[i], "multiset") == 0) {
+			tests::multiset::launch();
+		}
+		else if (strcmp(argv[i], "interval_map") == 0) {
+			tests::interval_map::launch();
+		}
+		else if (strcmp(argv[i], "concurrent_stack") == 0) {
+			tests::concurrent_stack::launch();
+		}
+		else if (strcmp(argv[i], "static_vector") == 0) {
+			tests::static_vector::launch();
+		}
 		else {
 			std::cout << "Unknown container_name : " << argv[i] << std::endl;
 		}
@@ -1,7 +1,10 @@
 #include <sys/time.h>
+#include <algorithm>
 #include <map>
+#include <string>
 
 #include "map.hpp"
+#include "tests.hpp"
 
 namespace tests { namespace map
 {
@@ -293,6 +296,60 @@ namespace tests { namespace map
 		std::cout << std::flush;
 	}
 
+	void emplace()
+	{
+		std::cout << "emplace tests :\n";
+
+		NAMESPACE::map<int, std::string> map;
+		NAMESPACE::pair<NAMESPACE::map<int, std::string>::iterator, bool> pair;
+		NAMESPACE::map<int, std::string>::iterator it;
+
+#if IS_FT || __cplusplus >= 201103L
+		pair = map.emplace(21, std::string(3, 'a'));
+#else
+		pair = map.insert(NAMESPACE::make_pair(21, std::string(3, 'a')));
+#endif
+		std::cout << "- new key and mapped value emplace return : ["
+			<< pair.first->first << ", " << pair.first->second << "], "
+			<< std::boolalpha << pair.second << "\n";
+#if IS_FT || __cplusplus >= 201103L
+		pair = map.emplace(21, "b");
+#else
+		pair = map.insert(NAMESPACE::make_pair(21, std::string("b")));
+#endif
+		std::cout << "- key already present emplace return : ["
+			<< pair.first->first << ", " << pair.first->second << "], "
+			<< std::boolalpha << pair.second << "\n";
+#if IS_FT || __cplusplus >= 201103L
+		pair = map.emplace(NAMESPACE::make_pair(42, std::string("c")));
+#else
+		pair = map.insert(NAMESPACE::make_pair(42, std::string("c")));
+#endif
+		std::cout << "- pair emplace return : ["
+			<< pair.first->first << ", " << pair.first->second << "], "
+			<< std::boolalpha << pair.second << "\n";
+
+#if IS_FT || __cplusplus >= 201103L
+		it = map.emplace_hint(map.end(), 84, "d");
+		it = map.emplace_hint(map.begin(), 1, "e");
+		it = map.emplace_hint(map.begin(), 42, "f");
+#else
+		it = map.insert(map.end(), NAMESPACE::make_pair(84, std::string("d")));
+		it = map.insert(map.begin(), NAMESPACE::make_pair(1, std::string("e")));
+		it = map.insert(map.begin(), NAMESPACE::make_pair(42, std::string("f")));
+#endif
+		std::cout << "- hint emplace return : ["
+			<< it->first << ", " << it->second << "]" << "\n";
+		std::cout << "- after emplace, values :";
+		for (NAMESPACE::map<int, std::string>::const_iterator cit = map.begin(),
+				cite = map.end(); cit != cite; ++cit) {
+			std::cout << " [" << cit->first << ", " << cit->second << "]";
+		}
+		std::cout << ", size : " << map.size() << "\n";
+
+		std::cout << std::flush;
+	}
+
 	void erase()
 	{
 		std::cout << "erase tests :\n";
@@ -414,6 +471,148 @@ namespace tests { namespace map
 		std::cout << std::flush;
 	}
 
+	void split_join()
+	{
+		std::cout << "split and join tests :\n";
+
+		NAMESPACE::map<int, int> map;
+		for (int i = 1; i <= 10; ++i) {
+			map[i] = i * 11;
+		}
+		NAMESPACE::map<int, int> upper;
+#if IS_FT
+		map.split(6, upper);
+#else
+		upper.insert(map.lower_bound(6), map.end());
+		map.erase(map.lower_bound(6), map.end());
+#endif
+		std::cout << "- after split, lower values :";
+		for (NAMESPACE::map<int, int>::const_iterator cit = map.begin(),
+				cite = map.end(); cit != cite; ++cit) {
+			std::cout << " [" << cit->first << ", " << cit->second << "]";
+		}
+		std::cout << ", size : " << map.size() << "\n";
+		std::cout << "- after split, upper values :";
+		for (NAMESPACE::map<int, int>::const_iterator cit = upper.begin(),
+				cite = upper.end(); cit != cite; ++cit) {
+			std::cout << " [" << cit->first << ", " << cit->second << "]";
+		}
+		std::cout << ", size : " << upper.size() << "\n";
+
+#if IS_FT
+		map.join(upper);
+#else
+		map.insert(upper.begin(), upper.end());
+		upper.clear();
+#endif
+		std::cout << "- after join, values :";
+		for (NAMESPACE::map<int, int>::const_iterator cit = map.begin(),
+				cite = map.end(); cit != cite; ++cit) {
+			std::cout << " [" << cit->first << ", " << cit->second << "]";
+		}
+		std::cout << ", size : " << map.size() << "\n";
+		std::cout << "- after join, joined values :";
+		for (NAMESPACE::map<int, int>::const_iterator cit = upper.begin(),
+				cite = upper.end(); cit != cite; ++cit) {
+			std::cout << " [" << cit->first << ", " << cit->second << "]";
+		}
+		std::cout << ", size : " << upper.size() << "\n";
+
+		for (int i = 5; i <= 15; ++i) {
+			upper[i] = i * 111;
+		}
+#if IS_FT
+		map.join(upper);
+#else
+		for (NAMESPACE::map<int, int>::iterator it = upper.begin();
+				it != upper.end();) {
+			if (map.insert(*it).second == true) {
+				upper.erase(it++);
+			}
+			else {
+				++it;
+			}
+		}
+#endif
+		std::cout << "- after overlapping join, values :";
+		for (NAMESPACE::map<int, int>::const_iterator cit = map.begin(),
+				cite = map.end(); cit != cite; ++cit) {
+			std::cout << " [" << cit->first << ", " << cit->second << "]";
+		}
+		std::cout << ", size : " << map.size() << "\n";
+		std::cout << "- after overlapping join, values left in joined :";
+		for (NAMESPACE::map<int, int>::const_iterator cit = upper.begin(),
+				cite = upper.end(); cit != cite; ++cit) {
+			std::cout << " [" << cit->first << ", " << cit->second << "]";
+		}
+		std::cout << ", size : " << upper.size() << "\n";
+
+		std::cout << std::flush;
+	}
+
+	void extract_merge()
+	{
+		std::cout << "extract and merge tests :\n";
+
+		NAMESPACE::map<int, int> map;
+		NAMESPACE::map<int, int> other;
+		for (int i = 1; i <= 6; ++i) {
+			map[i] = i;
+			other[i] = -i;
+		}
+#if IS_FT
+		NAMESPACE::map<int, int>::node_type nh = map.extract(3);
+		std::cout << "- extracted node : [" << nh.key() << ", " << nh.mapped()
+			<< "]\n";
+		nh.mapped() = 33;
+		NAMESPACE::map<int, int>::insert_return_type ret = other.insert(nh);
+		std::cout << "- node insert, inserted : " << std::boolalpha
+			<< ret.inserted << ", position : [" << ret.position->first << ", "
+			<< ret.position->second << "], node empty : " << nh.empty()
+			<< "\n";
+#else
+		std::cout << "- extracted node : [" << 3 << ", " << map[3] << "]\n";
+		map.erase(3);
+		NAMESPACE::pair<NAMESPACE::map<int, int>::iterator, bool> ret
+			= other.insert(NAMESPACE::make_pair(3, 33));
+		std::cout << "- node insert, inserted : " << std::boolalpha
+			<< ret.second << ", position : [" << ret.first->first << ", "
+			<< ret.first->second << "], node empty : " << true << "\n";
+#endif
+		std::cout << "- after extract, values :";
+		for (NAMESPACE::map<int, int>::const_iterator cit = map.begin(),
+				cite = map.end(); cit != cite; ++cit) {
+			std::cout << " [" << cit->first << ", " << cit->second << "]";
+		}
+		std::cout << ", size : " << map.size() << "\n";
+#if IS_FT
+		map.merge(other);
+#else
+		for (NAMESPACE::map<int, int>::iterator it = other.begin(); it != other.end();) {
+			if (map.insert(*it).second == true) {
+				other.erase(it++);
+			}
+			else {
+				++it;
+			}
+		}
+#endif
+		std::cout << "- after merge, values :";
+		for (NAMESPACE::map<int, int>::const_iterator cit = map.begin(),
+				cite = map.end(); cit != cite; ++cit) {
+			std::cout << " [" << cit->first << ", " << cit->second << "]";
+		}
+		std::cout << ", size : " << map.size() << "\n";
+		std::cout << "- after merge, source values :";
+		for (NAMESPACE::map<int, int>::const_iterator cit = other.begin(),
+				cite = other.end(); cit != cite; ++cit) {
+			std::cout << " [" << cit->first << ", " << cit->second << "]";
+		}
+		std::cout << ", size : " << other.size() << "\n";
+
+		std::cout << std::flush;
+	}
+
 	template <class T>
 	struct comp_util
 	{
@@ -585,6 +784,55 @@ namespace tests { namespace map
 		std::cout << std::flush;
 	}
 
+	struct double_mapped
+	{
+		int sum;
+
+		double_mapped() :
+			sum(0)
+		{
+			return;
+		}
+
+		void operator()(NAMESPACE::pair<int const, int>& val)
+		{
+			val.second *= 2;
+			this->sum += val.second;
+		}
+	};
+
+	void for_each_in_range()
+	{
+		std::cout << "for_each_in_range tests :\n";
+
+		NAMESPACE::map<int, int> map;
+		for (int i = 0; i < 1000; ++i) {
+			map[(i * 7919) % 1000] = i;
+		}
+		double_mapped fn;
+#if IS_FT
+		fn = map.for_each_in_range(100, 200, fn);
+#else
+		fn = std::for_each(map.lower_bound(100), map.lower_bound(200), fn);
+#endif
+		std::cout << "- [100, 200) sum : " << fn.sum << ", map[99] : " << map[99]
+			<< ", map[100] : " << map[100] << ", map[199] : " << map[199]
+			<< ", map[200] : " << map[200] << "\n";
+		fn = double_mapped();
+#if IS_FT
+		fn = map.for_each_in_range(-5, 3, fn);
+		fn = map.for_each_in_range(997, 2000, fn);
+		fn = map.for_each_in_range(500, 500, fn);
+#else
+		fn = std::for_each(map.lower_bound(-5), map.lower_bound(3), fn);
+		fn = std::for_each(map.lower_bound(997), map.lower_bound(2000), fn);
+		fn = std::for_each(map.lower_bound(500), map.lower_bound(500), fn);
+#endif
+		std::cout << "- bounds outside the keys, sum : " << fn.sum << "\n";
+
+		std::cout << std::flush;
+	}
+
 	void get_allocator()
 	{
 		std::cout << "get_allocator tests : ";
@@ -689,12 +937,18 @@ namespace tests { namespace map
 		std::cout << "\n";
 		insert();
 		std::cout << "\n";
+		emplace();
+		std::cout << "\n";
 		erase();
 		std::cout << "\n";
 		swap();
 		std::cout << "\n";
 		clear();
 		std::cout << "\n";
+		split_join();
+		std::cout << "\n";
+		extract_merge();
+		std::cout << "\n";
 		key_comp();
 		std::cout << "\n";
 		value_comp();
@@ -709,6 +963,8 @@ namespace tests { namespace map
 		std::cout << "\n";
 		equal_range();
 		std::cout << "\n";
+		for_each_in_range();
+		std::cout << "\n";
 		get_allocator();
 		std::cout << "\n";
 		relational_operators();
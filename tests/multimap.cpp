@@ -0,0 +1,130 @@
+#include <sys/time.h>
+#include <iostream>
+#include <map>
+
+#include "multimap.hpp"
+#include "tests.hpp"
+
+namespace tests { namespace multimap
+{
+	typedef NAMESPACE::multimap<int, int> int_multimap;
+
+	int const nb_elems = 3000;
+
+	void print_multimap(int_multimap const& mm, int max_printed)
+	{
+		std::cout << " size " << mm.size() << " :";
+		int printed = 0;
+		for (int_multimap::const_iterator cit = mm.begin(), cite = mm.end();
+				cit != cite && printed < max_printed; ++cit, ++printed) {
+			std::cout << " " << cit->first << ":" << cit->second;
+		}
+		std::cout << "\n";
+	}
+
+	void modifiers()
+	{
+		std::cout << "modifiers tests :\n";
+
+		int_multimap mm;
+		for (int i = 0; i < nb_elems; ++i) {
+			mm.insert(NAMESPACE::make_pair((i * 7919) % 10, i));
+		}
+		std::cout << "- insert, equal keys keep insertion order :";
+		print_multimap(mm, 12);
+
+		int_multimap hinted;
+		for (int i = 0; i < nb_elems; ++i) {
+			hinted.insert(hinted.end(), NAMESPACE::make_pair(i / 4, i));
+		}
+		hinted.insert(hinted.begin(), NAMESPACE::make_pair(-1, 0));
+		hinted.insert(hinted.find(5), NAMESPACE::make_pair(5, -5));
+		std::cout << "- hinted insert :";
+		print_multimap(hinted, 30);
+
+		int_multimap past_hint;
+		past_hint.insert(NAMESPACE::make_pair(1, 0));
+		past_hint.insert(NAMESPACE::make_pair(3, 1));
+		past_hint.insert(NAMESPACE::make_pair(5, 2));
+		past_hint.insert(past_hint.find(1), NAMESPACE::make_pair(3, 99));
+		past_hint.insert(past_hint.find(1), NAMESPACE::make_pair(5, 77));
+		past_hint.insert(past_hint.find(5), NAMESPACE::make_pair(1, 55));
+		std::cout << "- hinted insert past the hint :";
+		print_multimap(past_hint, 30);
+
+		int_multimap copy(mm);
+		std::cout << "- key erase, erased : " << mm.erase(3) << ", "
+			<< mm.erase(42) << ",";
+		print_multimap(mm, 12);
+
+		int_multimap::iterator first = mm.lower_bound(5);
+		++first;
+		mm.erase(first, mm.upper_bound(7));
+		mm.erase(mm.begin());
+		std::cout << "- iterator and range erase :";
+		print_multimap(mm, 12);
+
+		std::cout << "- copy, (mm == copy) : " << std::boolalpha
+			<< (mm == copy) << ", (mm > copy) : " << (mm > copy) << ",";
+		print_multimap(copy, 12);
+
+		mm.swap(copy);
+		copy.clear();
+		std::cout << "- swap and clear, copy.empty() : " << copy.empty() << ",";
+		print_multimap(mm, 4);
+
+		std::cout << std::flush;
+	}
+
+	void lookup()
+	{
+		std::cout << "lookup tests :\n";
+
+		int_multimap mm;
+		for (int i = 0; i < nb_elems; ++i) {
+			mm.insert(NAMESPACE::make_pair(i % 50 * 2, i));
+		}
+		int_multimap const& cmm = mm;
+		std::cout << "- count(4) : " << cmm.count(4) << ", count(5) : "
+			<< cmm.count(5) << ", find(6) : " << cmm.find(6)->second
+			<< ", (find(7) == end()) : " << std::boolalpha
+			<< (cmm.find(7) == cmm.end()) << "\n";
+		NAMESPACE::pair<int_multimap::iterator, int_multimap::iterator> range
+			= mm.equal_range(98);
+		int sum = 0;
+		for (; range.first != range.second; ++range.first) {
+			sum += range.first->second;
+		}
+		std::cout << "- equal_range(98) sum : " << sum
+			<< ", (equal_range(99) empty) : "
+			<< (cmm.equal_range(99).first == cmm.equal_range(99).second)
+			<< ", lower_bound(97) : " << cmm.lower_bound(97)->second
+			<< ", upper_bound(0) : " << cmm.upper_bound(0)->second << "\n";
+
+		std::cout << std::flush;
+	}
+
+	void launch()
+	{
+		struct timeval	timeval;
+
+		if (gettimeofday(&timeval, NULL) == -1) {
+			std::cout << "gettimeofday failed" << std::endl;
+			return;
+		}
+		unsigned long long time_start = timeval.tv_sec * 1000000 + timeval.tv_usec;
+
+		modifiers();
+		std::cout << "\n";
+		lookup();
+
+		if (gettimeofday(&timeval, NULL) == -1) {
+			std::cout << "gettimeofday failed" << std::endl;
+			return;
+		}
+		unsigned long long time_end = timeval.tv_sec * 1000000 + timeval.tv_usec;
+
+		std::cout << "\nTests duration : " << time_end - time_start
+			<< " microseconds" << std::endl;
+	}
+} }
@@ -0,0 +1,144 @@
+#include <sys/time.h>
+#include <iostream>
+#include <set>
+
+#include "multiset.hpp"
+#include "tests.hpp"
+
+namespace tests { namespace multiset
+{
+	typedef NAMESPACE::multiset<int> int_multiset;
+
+	int const nb_elems = 3000;
+
+	void print_multiset(int_multiset const& ms, int max_printed)
+	{
+		std::cout << " size " << ms.size() << " :";
+		int printed = 0;
+		for (int_multiset::const_iterator cit = ms.begin(), cite = ms.end();
+				cit != cite && printed < max_printed; ++cit, ++printed) {
+			std::cout << " " << *cit;
+		}
+		std::cout << "\n";
+	}
+
+	// Values of the same tens are equivalent, their order shows where
+	// they were linked.
+	struct tens_less
+	{
+		bool operator()(int lhs, int rhs) const
+		{
+			return lhs / 10 < rhs / 10;
+		}
+	};
+
+	void modifiers()
+	{
+		std::cout << "modifiers tests :\n";
+
+		int_multiset ms;
+		for (int i = 0; i < nb_elems; ++i) {
+			ms.insert((i * 7919) % 100);
+		}
+		std::cout << "- insert :";
+		print_multiset(ms, 40);
+
+		int_multiset hinted;
+		for (int i = 0; i < nb_elems; ++i) {
+			hinted.insert(hinted.end(), i / 3);
+		}
+		hinted.insert(hinted.begin(), 2000);
+		hinted.insert(hinted.find(5), 5);
+		std::cout << "- hinted insert :";
+		print_multiset(hinted, 30);
+
+		NAMESPACE::multiset<int, tens_less> past_hint;
+		past_hint.insert(10);
+		past_hint.insert(30);
+		past_hint.insert(50);
+		past_hint.insert(past_hint.find(10), 39);
+		past_hint.insert(past_hint.find(10), 57);
+		past_hint.insert(past_hint.find(50), 15);
+		std::cout << "- hinted insert past the hint, by tens :";
+		for (NAMESPACE::multiset<int, tens_less>::const_iterator
+				cit = past_hint.begin(), cite = past_hint.end(); cit != cite;
+				++cit) {
+			std::cout << " " << *cit;
+		}
+		std::cout << "\n";
+
+		int_multiset copy(ms);
+		std::cout << "- value erase, erased : " << ms.erase(0) << ", "
+			<< ms.erase(1000) << ",";
+		print_multiset(ms, 40);
+
+		int_multiset::iterator first = ms.lower_bound(5);
+		++first;
+		ms.erase(first, ms.upper_bound(60));
+		ms.erase(ms.begin());
+		std::cout << "- iterator and range erase :";
+		print_multiset(ms, 100);
+
+		std::cout << "- copy, (ms == copy) : " << std::boolalpha
+			<< (ms == copy) << ", (ms > copy) : " << (ms > copy) << ",";
+		print_multiset(copy, 40);
+
+		ms.swap(copy);
+		copy.clear();
+		std::cout << "- swap and clear, copy.empty() : " << copy.empty() << ",";
+		print_multiset(ms, 4);
+
+		std::cout << std::flush;
+	}
+
+	void lookup()
+	{
+		std::cout << "lookup tests :\n";
+
+		int_multiset ms;
+		for (int i = 0; i < nb_elems; ++i) {
+			ms.insert(i % 50 * 2);
+		}
+		std::cout << "- count(4) : " << ms.count(4) << ", count(5) : "
+			<< ms.count(5) << ", find(6) : " << *ms.find(6)
+			<< ", (find(7) == end()) : " << std::boolalpha
+			<< (ms.find(7) == ms.end()) << "\n";
+		NAMESPACE::pair<int_multiset::iterator, int_multiset::iterator> range
+			= ms.equal_range(98);
+		int n = 0;
+		for (; range.first != range.second; ++range.first) {
+			n++;
+		}
+		std::cout << "- equal_range(98) length : " << n
+			<< ", (equal_range(99) empty) : "
+			<< (ms.equal_range(99).first == ms.equal_range(99).second)
+			<< ", lower_bound(97) : " << *ms.lower_bound(97)
+			<< ", upper_bound(0) : " << *ms.upper_bound(0) << "\n";
+
+		std::cout << std::flush;
+	}
+
+	void launch()
+	{
+		struct timeval	timeval;
+
+		if (gettimeofday(&timeval, NULL) == -1) {
+			std::cout << "gettimeofday failed" << std::endl;
+			return;
+		}
+		unsigned long long time_start = timeval.tv_sec * 1000000 + timeval.tv_usec;
+
+		modifiers();
+		std::cout << "\n";
+		lookup();
+
+		if (gettimeofday(&timeval, NULL) == -1) {
+			std::cout << "gettimeofday failed" << std::endl;
+			return;
+		}
+		unsigned long long time_end = timeval.tv_sec * 1000000 + timeval.tv_usec;
+
+		std::cout << "\nTests duration : " << time_end - time_start
+			<< " microseconds" << std::endl;
+	}
+} }
@@ -0,0 +1,259 @@
+#include <sys/time.h>
+#include <pthread.h>
+#include <iostream>
+#include <string>
+
+#include "tests.hpp"
+
+#if IS_FT
+# include "persistent_map.hpp"
+# define PERSISTENT_MAP ft::persistent_map
+#else
+# include <map>
+# define PERSISTENT_MAP std::map
+#endif
+
+namespace tests { namespace persistent_map
+{
+	typedef PERSISTENT_MAP<int, int> int_map;
+
+	int const nb_elems = 5000;
+	int const nb_threads = 4;
+
+	int shuffled_key(int i)
+	{
+		return (i * 7919) % nb_elems;
+	}
+
+	int_map snapshot(int_map const& map)
+	{
+#if IS_FT
+		return map.snapshot();
+#else
+		return map;
+#endif
+	}
+
+	void insert_or_assign(int_map& map, int k, int value)
+	{
+#if IS_FT
+		map.insert_or_assign(NAMESPACE::make_pair(k, value));
+#else
+		map[k] = value;
+#endif
+		return;
+	}
+
+	void print_summary(int_map const& map)
+	{
+		long long key_sum = 0;
+		long long value_sum = 0;
+		int previous = -nb_elems - 1;
+		bool sorted = true;
+		for (int_map::const_iterator cit = map.begin(), cite = map.end();
+				cit != cite; ++cit) {
+			key_sum += cit->first;
+			value_sum += cit->second;
+			sorted = sorted && previous < cit->first;
+			previous = cit->first;
+		}
+		std::cout << " size " << map.size() << ", key sum " << key_sum
+			<< ", value sum " << value_sum << ", sorted " << std::boolalpha
+			<< sorted;
+		if (map.empty() == false) {
+			std::cout << ", front " << map.begin()->first << ", back "
+				<< map.rbegin()->first;
+		}
+		std::cout << "\n";
+	}
+
+	void modifiers()
+	{
+		std::cout << "modifiers tests :\n";
+
+		int_map map;
+		int inserted = 0;
+		for (int i = 0; i < nb_elems; ++i) {
+			inserted += map.insert(NAMESPACE::make_pair(shuffled_key(i) / 3, i))
+				.second;
+		}
+		std::cout << "- insert, inserted : " << inserted << ",";
+		print_summary(map);
+
+		for (int i = 0; i < nb_elems; i += 3) {
+			insert_or_assign(map, i, -i);
+		}
+		std::cout << "- insert_or_assign :";
+		print_summary(map);
+
+		int erased = 0;
+		for (int i = 0; i < nb_elems; i += 2) {
+			erased += map.erase(i);
+		}
+		map.erase(map.begin());
+		std::cout << "- erase, erased : " << erased << ",";
+		print_summary(map);
+
+		int_map other;
+		other.insert(NAMESPACE::make_pair(42, 42));
+		map.swap(other);
+		std::cout << "- swap :";
+		print_summary(map);
+
+		other.clear();
+		std::cout << "- clear :";
+		print_summary(other);
+
+		std::cout << std::flush;
+	}
+
+	void snapshots()
+	{
+		std::cout << "snapshots tests :\n";
+
+		int_map map;
+		for (int i = 0; i < nb_elems; ++i) {
+			map.insert(NAMESPACE::make_pair(shuffled_key(i), i));
+		}
+		int_map first = snapshot(map);
+		for (int i = 0; i < nb_elems; i += 2) {
+			map.erase(i);
+		}
+		int_map second = snapshot(map);
+		for (int i = 0; i < nb_elems; i += 5) {
+			insert_or_assign(map, i, 0);
+		}
+		int_map copy(map);
+		copy.insert(NAMESPACE::make_pair(nb_elems, nb_elems));
+		std::cout << "- first snapshot :";
+		print_summary(first);
+		std::cout << "- second snapshot :";
+		print_summary(second);
+		std::cout << "- map :";
+		print_summary(map);
+		std::cout << "- copy written to :";
+		print_summary(copy);
+
+		first = second;
+		second.clear();
+		std::cout << "- assigned snapshot :";
+		print_summary(first);
+		std::cout << "- (first < map) : " << std::boolalpha << (first < map)
+			<< ", (first == first) : " << (first == first) << "\n";
+
+		std::cout << std::flush;
+	}
+
+	void lookup()
+	{
+		std::cout << "lookup tests :\n";
+
+		int_map map;
+		for (int i = 0; i < nb_elems; i += 3) {
+			map.insert(NAMESPACE::make_pair(i, i * 2));
+		}
+		int_map::const_iterator lower = map.lower_bound(100);
+		int_map::const_iterator upper = map.upper_bound(102);
+		std::cout << "- find(9) : " << map.find(9)->second << ", count(9) : "
+			<< map.count(9) << ", count(10) : " << map.count(10)
+			<< ", lower_bound(100) : " << lower->first
+			<< ", upper_bound(102) : " << upper->first
+			<< ", --upper_bound(102) : " << (--upper)->first
+			<< ", equal_range(99) : " << map.equal_range(99).first->first
+			<< " " << map.equal_range(99).second->first << "\n";
+
+		std::cout << std::flush;
+	}
+
+	struct thread_arg
+	{
+		int_map* snapshot;
+		std::size_t size;
+		long long key_sum;
+		long long value_sum;
+	};
+
+	// Reads a snapshot and frees it while the map it was taken from is
+	// written to by the main thread.
+	void* read_and_delete(void* arg)
+	{
+		thread_arg* targ = static_cast<thread_arg*>(arg);
+		targ->size = targ->snapshot->size();
+		targ->key_sum = 0;
+		targ->value_sum = 0;
+		for (int_map::const_iterator cit = targ->snapshot->begin(),
+				cite = targ->snapshot->end(); cit != cite; ++cit) {
+			targ->key_sum += cit->first;
+			targ->value_sum += cit->second;
+		}
+		delete targ->snapshot;
+		return NULL;
+	}
+
+	void threads()
+	{
+		std::cout << "threads tests :\n";
+
+		int_map map;
+		for (int i = 0; i < nb_elems; ++i) {
+			map.insert(NAMESPACE::make_pair(shuffled_key(i), i));
+		}
+		pthread_t threads[nb_threads];
+		thread_arg args[nb_threads];
+		bool started[nb_threads];
+		for (int i = 0; i < nb_threads; ++i) {
+			args[i].snapshot = new int_map(snapshot(map));
+			started[i] = pthread_create(&threads[i], NULL, &read_and_delete,
+					&args[i]) == 0;
+			if (started[i] == false) {
+				read_and_delete(&args[i]);
+			}
+			for (int k = i; k < nb_elems; k += nb_threads + i) {
+				insert_or_assign(map, k, -k);
+			}
+			for (int k = i; k < nb_elems; k += 7) {
+				map.erase(k);
+			}
+		}
+		for (int i = 0; i < nb_threads; ++i) {
+			if (started[i] == true) {
+				pthread_join(threads[i], NULL);
+			}
+			std::cout << "- snapshot " << i << " read on its thread : size "
+				<< args[i].size << ", key sum " << args[i].key_sum
+				<< ", value sum " << args[i].value_sum << "\n";
+		}
+		std::cout << "- map written to meanwhile :";
+		print_summary(map);
+
+		std::cout << std::flush;
+	}
+
+	void launch()
+	{
+		struct timeval	timeval;
+
+		if (gettimeofday(&timeval, NULL) == -1) {
+			std::cout << "gettimeofday failed" << std::endl;
+			return;
+		}
+		unsigned long long time_start = timeval.tv_sec * 1000000 + timeval.tv_usec;
+
+		modifiers();
+		std::cout << "\n";
+		snapshots();
+		std::cout << "\n";
+		lookup();
+		std::cout << "\n";
+		threads();
+
+		if (gettimeofday(&timeval, NULL) == -1) {
+			std::cout << "gettimeofday failed" << std::endl;
+			return;
+		}
+		unsigned long long time_end = timeval.tv_sec * 1000000 + timeval.tv_usec;
+
+		std::cout << "\nTests duration : " << time_end - time_start
+			<< " microseconds" << std::endl;
+	}
+} }
@@ -1,7 +1,10 @@
 #include <sys/time.h>
+#include <algorithm>
 #include <set>
+#include <string>
 
 #include "set.hpp"
+#include "tests.hpp"
 
 namespace tests { namespace set
 {
@@ -264,6 +267,49 @@ namespace tests { namespace set
 		std::cout << std::flush;
 	}
 
+	void emplace()
+	{
+		std::cout << "emplace tests :\n";
+
+		NAMESPACE::set<std::string> set;
+		NAMESPACE::pair<NAMESPACE::set<std::string>::iterator, bool> pair;
+		NAMESPACE::set<std::string>::iterator it;
+
+#if IS_FT || __cplusplus >= 201103L
+		pair = set.emplace(3, 'b');
+#else
+		pair = set.insert(std::string(3, 'b'));
+#endif
+		std::cout << "- new element emplace return : "
+			<< *pair.first << ", " << std::boolalpha << pair.second << "\n";
+#if IS_FT || __cplusplus >= 201103L
+		pair = set.emplace(std::string("bbb"));
+#else
+		pair = set.insert(std::string("bbb"));
+#endif
+		std::cout << "- element already present emplace return : "
+			<< *pair.first << ", " << std::boolalpha << pair.second << "\n";
+
+#if IS_FT || __cplusplus >= 201103L
+		it = set.emplace_hint(set.end(), "c");
+		it = set.emplace_hint(set.begin(), 1, 'a');
+		it = set.emplace_hint(set.end(), "bbb");
+#else
+		it = set.insert(set.end(), std::string("c"));
+		it = set.insert(set.begin(), std::string(1, 'a'));
+		it = set.insert(set.end(), std::string("bbb"));
+#endif
+		std::cout << "- hint emplace return : " << *it << "\n";
+		std::cout << "- after emplace, values :";
+		for (NAMESPACE::set<std::string>::const_iterator cit = set.begin(),
+				cite = set.end(); cit != cite; ++cit) {
+			std::cout << " " << *cit;
+		}
+		std::cout << ", size : " << set.size() << "\n";
+
+		std::cout << std::flush;
+	}
+
 	void erase()
 	{
 		std::cout << "erase tests :\n";
@@ -385,6 +431,145 @@ namespace tests { namespace set
 		std::cout << std::flush;
 	}
 
+	void split_join()
+	{
+		std::cout << "split and join tests :\n";
+
+		NAMESPACE::set<int> set;
+		for (int i = 1; i <= 10; ++i) {
+			set.insert(i);
+		}
+		NAMESPACE::set<int> upper;
+#if IS_FT
+		set.split(6, upper);
+#else
+		upper.insert(set.lower_bound(6), set.end());
+		set.erase(set.lower_bound(6), set.end());
+#endif
+		std::cout << "- after split, lower values :";
+		for (NAMESPACE::set<int>::const_iterator cit = set.begin(),
+				cite = set.end(); cit != cite; ++cit) {
+			std::cout << " " << *cit;
+		}
+		std::cout << ", size : " << set.size() << "\n";
+		std::cout << "- after split, upper values :";
+		for (NAMESPACE::set<int>::const_iterator cit = upper.begin(),
+				cite = upper.end(); cit != cite; ++cit) {
+			std::cout << " " << *cit;
+		}
+		std::cout << ", size : " << upper.size() << "\n";
+
+#if IS_FT
+		set.join(upper);
+#else
+		set.insert(upper.begin(), upper.end());
+		upper.clear();
+#endif
+		std::cout << "- after join, values :";
+		for (NAMESPACE::set<int>::const_iterator cit = set.begin(),
+				cite = set.end(); cit != cite; ++cit) {
+			std::cout << " " << *cit;
+		}
+		std::cout << ", size : " << set.size() << "\n";
+		std::cout << "- after join, joined values :";
+		for (NAMESPACE::set<int>::const_iterator cit = upper.begin(),
+				cite = upper.end(); cit != cite; ++cit) {
+			std::cout << " " << *cit;
+		}
+		std::cout << ", size : " << upper.size() << "\n";
+
+		for (int i = 5; i <= 15; ++i) {
+			upper.insert(i);
+		}
+#if IS_FT
+		set.join(upper);
+#else
+		for (NAMESPACE::set<int>::iterator it = upper.begin();
+				it != upper.end();) {
+			if (set.insert(*it).second == true) {
+				upper.erase(it++);
+			}
+			else {
+				++it;
+			}
+		}
+#endif
+		std::cout << "- after overlapping join, values :";
+		for (NAMESPACE::set<int>::const_iterator cit = set.begin(),
+				cite = set.end(); cit != cite; ++cit) {
+			std::cout << " " << *cit;
+		}
+		std::cout << ", size : " << set.size() << "\n";
+		std::cout << "- after overlapping join, values left in joined :";
+		for (NAMESPACE::set<int>::const_iterator cit = upper.begin(),
+				cite = upper.end(); cit != cite; ++cit) {
+			std::cout << " " << *cit;
+		}
+		std::cout << ", size : " << upper.size() << "\n";
+
+		std::cout << std::flush;
+	}
+
+	void extract_merge()
+	{
+		std::cout << "extract and merge tests :\n";
+
+		NAMESPACE::set<int> set;
+		NAMESPACE::set<int> other;
+		for (int i = 1; i <= 6; ++i) {
+			set.insert(i);
+			other.insert(i * 2);
+		}
+#if IS_FT
+		NAMESPACE::set<int>::node_type nh = set.extract(3);
+		std::cout << "- extracted node : " << nh.value() << "\n";
+		NAMESPACE::set<int>::insert_return_type ret = other.insert(nh);
+		std::cout << "- node insert, inserted : " << std::boolalpha
+			<< ret.inserted << ", position : " << *ret.position
+			<< ", node empty : " << nh.empty() << "\n";
+#else
+		std::cout << "- extracted node : " << 3 << "\n";
+		set.erase(3);
+		NAMESPACE::pair<NAMESPACE::set<int>::iterator, bool> ret
+			= other.insert(3);
+		std::cout << "- node insert, inserted : " << std::boolalpha
+			<< ret.second << ", position : " << *ret.first
+			<< ", node empty : " << true << "\n";
+#endif
+		std::cout << "- after extract, values :";
+		for (NAMESPACE::set<int>::const_iterator cit = set.begin(),
+				cite = set.end(); cit != cite; ++cit) {
+			std::cout << " " << *cit;
+		}
+		std::cout << ", size : " << set.size() << "\n";
+#if IS_FT
+		set.merge(other);
+#else
+		for (NAMESPACE::set<int>::iterator it = other.begin(); it != other.end();) {
+			if (set.insert(*it).second == true) {
+				other.erase(it++);
+			}
+			else {
+				++it;
+			}
+		}
+#endif
+		std::cout << "- after merge, values :";
+		for (NAMESPACE::set<int>::const_iterator cit = set.begin(),
+				cite = set.end(); cit != cite; ++cit) {
+			std::cout << " " << *cit;
+		}
+		std::cout << ", size : " << set.size() << "\n";
+		std::cout << "- after merge, source values :";
+		for (NAMESPACE::set<int>::const_iterator cit = other.begin(),
+				cite = other.end(); cit != cite; ++cit) {
+			std::cout << " " << *cit;
+		}
+		std::cout << ", size : " << other.size() << "\n";
+
+		std::cout << std::flush;
+	}
+
 	template <class T>
 	struct comp_util
 	{
@@ -549,6 +734,57 @@ namespace tests { namespace set
 		std::cout << std::flush;
 	}
 
+	struct sum_values
+	{
+		long sum;
+		int count;
+
+		sum_values() :
+			sum(0),
+			count(0)
+		{
+			return;
+		}
+
+		void operator()(int const& val)
+		{
+			this->sum += val;
+			this->count++;
+		}
+	};
+
+	void for_each_in_range()
+	{
+		std::cout << "for_each_in_range tests :\n";
+
+		NAMESPACE::set<int> set;
+		for (int i = 0; i < 1000; ++i) {
+			set.insert((i * 7919) % 1000 * 3);
+		}
+		sum_values fn;
+#if IS_FT
+		fn = set.for_each_in_range(100, 200, fn);
+#else
+		fn = std::for_each(set.lower_bound(100), set.lower_bound(200), fn);
+#endif
+		std::cout << "- [100, 200) sum : " << fn.sum << ", count : " << fn.count
+			<< "\n";
+		fn = sum_values();
+#if IS_FT
+		fn = set.for_each_in_range(-5, 7, fn);
+		fn = set.for_each_in_range(2995, 5000, fn);
+		fn = set.for_each_in_range(301, 302, fn);
+#else
+		fn = std::for_each(set.lower_bound(-5), set.lower_bound(7), fn);
+		fn = std::for_each(set.lower_bound(2995), set.lower_bound(5000), fn);
+		fn = std::for_each(set.lower_bound(301), set.lower_bound(302), fn);
+#endif
+		std::cout << "- bounds outside the values, sum : " << fn.sum
+			<< ", count : " << fn.count << "\n";
+
+		std::cout << std::flush;
+	}
+
 	void get_allocator()
 	{
 		std::cout << "get_allocator tests : ";
@@ -653,12 +889,18 @@ namespace tests { namespace set
 		std::cout << "\n";
 		insert();
 		std::cout << "\n";
+		emplace();
+		std::cout << "\n";
 		erase();
 		std::cout << "\n";
 		swap();
 		std::cout << "\n";
 		clear();
 		std::cout << "\n";
+		split_join();
+		std::cout << "\n";
+		extract_merge();
+		std::cout << "\n";
 		key_comp();
 		std::cout << "\n";
 		value_comp();
@@ -673,6 +915,8 @@ namespace tests { namespace set
 		std::cout << "\n";
 		equal_range();
 		std::cout << "\n";
+		for_each_in_range();
+		std::cout << "\n";
 		get_allocator();
 		std::cout << "\n";
 		relational_operators();
@@ -0,0 +1,286 @@
+#include <sys/time.h>
+#include <pthread.h>
+#include <iostream>
+#include <string>
+
+#include "tests.hpp"
+
+#if IS_FT
+# include "sharded_map.hpp"
+# include "pair.hpp"
+# define SHARDED_MAP ft::sharded_map
+# define MAKE_PAIR ft::make_pair
+#else
+# include <map>
+# include <utility>
+# define MAKE_PAIR std::make_pair
+
+namespace tests { namespace sharded_map
+{
+	// single mutex std::map with the sharded_map interface
+	template <class Key, class T>
+	class locked_map
+	{
+	public:
+		typedef std::pair<Key const, T> value_type;
+		typedef typename std::map<Key, T>::const_iterator const_iterator;
+		typedef typename std::map<Key, T>::size_type size_type;
+
+		class read_guard
+		{
+		public:
+			explicit read_guard(locked_map const& map) :
+				map_(map)
+			{
+				pthread_mutex_lock(&this->map_.mutex_);
+			}
+
+			~read_guard()
+			{
+				pthread_mutex_unlock(&this->map_.mutex_);
+			}
+
+		private:
+			locked_map const& map_;
+		};
+
+		explicit locked_map(size_type = 16)
+		{
+			pthread_mutex_init(&this->mutex_, NULL);
+		}
+
+		~locked_map()
+		{
+			pthread_mutex_destroy(&this->mutex_);
+		}
+
+		const_iterator begin() const { return this->map_.begin(); }
+		const_iterator end() const { return this->map_.end(); }
+		bool empty() const { return this->map_.empty(); }
+		size_type size() const { return this->map_.size(); }
+		size_type count(Key const& k) const { return this->map_.count(k); }
+
+		bool find(Key const& k, T& value) const
+		{
+			pthread_mutex_lock(&this->mutex_);
+			const_iterator it = this->map_.find(k);
+			bool found = it != this->map_.end();
+			if (found == true) {
+				value = it->second;
+			}
+			pthread_mutex_unlock(&this->mutex_);
+			return found;
+		}
+
+		bool insert(value_type const& val)
+		{
+			pthread_mutex_lock(&this->mutex_);
+			bool inserted = this->map_.insert(val).second;
+			pthread_mutex_unlock(&this->mutex_);
+			return inserted;
+		}
+
+		bool insert_or_assign(value_type const& val)
+		{
+			pthread_mutex_lock(&this->mutex_);
+			std::pair<typename std::map<Key, T>::iterator, bool> ret
+				= this->map_.insert(val);
+			if (ret.second == false) {
+				ret.first->second = val.second;
+			}
+			pthread_mutex_unlock(&this->mutex_);
+			return ret.second;
+		}
+
+		size_type erase(Key const& k)
+		{
+			pthread_mutex_lock(&this->mutex_);
+			size_type erased = this->map_.erase(k);
+			pthread_mutex_unlock(&this->mutex_);
+			return erased;
+		}
+
+		void clear() { this->map_.clear(); }
+
+	private:
+		mutable pthread_mutex_t mutex_;
+		std::map<Key, T> map_;
+	};
+} }
+
+# define SHARDED_MAP tests::sharded_map::locked_map
+#endif
+
+namespace tests { namespace sharded_map
+{
+	typedef SHARDED_MAP<int, int> int_map;
+
+	int const nb_elems = 5000;
+	int const nb_threads = 4;
+
+	int shuffled_key(int i)
+	{
+		return (i * 7919) % nb_elems;
+	}
+
+	void print_summary(int_map const& map)
+	{
+		int_map::read_guard guard(map);
+		long long key_sum = 0;
+		long long value_sum = 0;
+		int previous = -nb_elems - 1;
+		bool sorted = true;
+		for (int_map::const_iterator cit = map.begin(), cite = map.end();
+				cit != cite; ++cit) {
+			key_sum += cit->first;
+			value_sum += cit->second;
+			sorted = sorted && previous < cit->first;
+			previous = cit->first;
+		}
+		std::cout << " key sum " << key_sum << ", value sum " << value_sum
+			<< ", sorted " << std::boolalpha << sorted;
+		if (map.begin() != map.end()) {
+			std::cout << ", front " << map.begin()->first;
+		}
+		std::cout << "\n";
+	}
+
+	void modifiers()
+	{
+		std::cout << "modifiers tests :\n";
+
+		int_map map(7);
+		std::cout << "- empty : " << std::boolalpha << map.empty() << ",";
+		print_summary(map);
+
+		int inserted = 0;
+		for (int i = 0; i < nb_elems; ++i) {
+			inserted += map.insert(MAKE_PAIR(shuffled_key(i) / 3, i));
+		}
+		std::cout << "- insert, inserted : " << inserted << ", size "
+			<< map.size() << ",";
+		print_summary(map);
+
+		int assigned = 0;
+		for (int i = 0; i < nb_elems; i += 5) {
+			assigned += !map.insert_or_assign(MAKE_PAIR(i, -i));
+		}
+		std::cout << "- insert_or_assign, assigned : " << assigned << ", size "
+			<< map.size() << ",";
+		print_summary(map);
+
+		int erased = 0;
+		for (int i = 0; i < nb_elems; i += 2) {
+			erased += map.erase(i);
+		}
+		std::cout << "- erase, erased : " << erased << ", size "
+			<< map.size() << ",";
+		print_summary(map);
+
+		map.clear();
+		std::cout << "- clear : " << std::boolalpha << map.empty() << ",";
+		print_summary(map);
+
+		std::cout << std::flush;
+	}
+
+	void lookup()
+	{
+		std::cout << "lookup tests :\n";
+
+		int_map map;
+		for (int i = 0; i < nb_elems; i += 3) {
+			map.insert(MAKE_PAIR(i, i * 2));
+		}
+		int found = 0;
+		long long sum = 0;
+		for (int i = 0; i < nb_elems; ++i) {
+			int value = 0;
+			if (map.find(i, value) == true) {
+				found++;
+				sum += value;
+			}
+		}
+		std::cout << "- find, found : " << found << ", sum " << sum
+			<< ", count(9) : " << map.count(9) << ", count(10) : "
+			<< map.count(10) << "\n";
+
+		std::cout << std::flush;
+	}
+
+	struct thread_arg
+	{
+		int_map* map;
+		int index;
+	};
+
+	void* insert_and_erase(void* arg)
+	{
+		thread_arg* targ = static_cast<thread_arg*>(arg);
+		for (int i = targ->index; i < nb_elems; i += nb_threads) {
+			targ->map->insert(MAKE_PAIR(i, targ->index));
+			int value = 0;
+			targ->map->find(i, value);
+			if (i % 3 == 0) {
+				targ->map->erase(i);
+			}
+		}
+		return NULL;
+	}
+
+	void threads()
+	{
+		std::cout << "threads tests :\n";
+
+		int_map map;
+		pthread_t threads[nb_threads];
+		thread_arg args[nb_threads];
+		int started = 0;
+		for (int i = 0; i < nb_threads; ++i) {
+			args[i].map = &map;
+			args[i].index = i;
+			if (pthread_create(&threads[i], NULL, &insert_and_erase, &args[i])
+					!= 0) {
+				break;
+			}
+			started++;
+		}
+		for (int i = 0; i < started; ++i) {
+			pthread_join(threads[i], NULL);
+		}
+		for (int i = started; i < nb_threads; ++i) {
+			insert_and_erase(&args[i]);
+		}
+		std::cout << "- concurrent insert, find and erase : size "
+			<< map.size() << ",";
+		print_summary(map);
+
+		std::cout << std::flush;
+	}
+
+	void launch()
+	{
+		struct timeval	timeval;
+
+		if (gettimeofday(&timeval, NULL) == -1) {
+			std::cout << "gettimeofday failed" << std::endl;
+			return;
+		}
+		unsigned long long time_start = timeval.tv_sec * 1000000 + timeval.tv_usec;
+
+		modifiers();
+		std::cout << "\n";
+		lookup();
+		std::cout << "\n";
+		threads();
+
+		if (gettimeofday(&timeval, NULL) == -1) {
+			std::cout << "gettimeofday failed" << std::endl;
+			return;
+		}
+		unsigned long long time_end = timeval.tv_sec * 1000000 + timeval.tv_usec;
+
+		std::cout << "\nTests duration : " << time_end - time_start
+			<< " microseconds" << std::endl;
+	}
+} }
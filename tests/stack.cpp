@@ -4,6 +4,14 @@
 
 #include "stack.hpp"
 #include "vector.hpp"
+#include "tests.hpp"
+
+#if IS_FT
+# include "static_vector.hpp"
+# define STATIC_CONTAINER ft::static_vector<int, 64>
+#else
+# define STATIC_CONTAINER std::vector<int>
+#endif
 
 namespace tests { namespace stack
 {
@@ -156,6 +164,57 @@ namespace tests { namespace stack
 		std::cout << std::flush;
 	}
 
+	void static_container()
+	{
+		std::cout << "static container tests :\n";
+
+		NAMESPACE::stack<int, STATIC_CONTAINER > stack;
+		for (int i = 0; i < 64; ++i) {
+			stack.push(i);
+		}
+		NAMESPACE::stack<int, STATIC_CONTAINER > stack2(stack);
+		std::cout << "- 64 pushes, size() : " << stack.size() << ", top() : "
+			<< stack.top() << "\n";
+		while (stack.size() > 10) {
+			stack.pop();
+		}
+		std::cout << "- pops, size() : " << stack.size() << ", top() : "
+			<< stack.top() << ", stack < stack2 : " << std::boolalpha
+			<< (stack < stack2) << ", stack == stack2 : " << (stack == stack2)
+			<< "\n";
+
+		std::cout << std::flush;
+	}
+
+	void bulk()
+	{
+		std::cout << "bulk tests :\n";
+
+		NAMESPACE::stack<int> stack;
+		int const tokens[] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+#if IS_FT
+		stack.reserve(64);
+		stack.push_range(tokens, tokens + 8);
+#else
+		for (int i = 0; i < 8; ++i) {
+			stack.push(tokens[i]);
+		}
+#endif
+		std::cout << "- push_range, size() : " << stack.size() << ", top() : "
+			<< stack.top() << "\n";
+#if IS_FT
+		stack.pop_n(5);
+#else
+		for (int i = 0; i < 5; ++i) {
+			stack.pop();
+		}
+#endif
+		std::cout << "- pop_n(5), size() : " << stack.size() << ", top() : "
+			<< stack.top() << "\n";
+
+		std::cout << std::flush;
+	}
+
 	void launch()
 	{
 		struct timeval	timeval;
@@ -181,6 +240,10 @@ namespace tests { namespace stack
 		pop();
 		std::cout << "\n";
 		relational_operators();
+		std::cout << "\n";
+		static_container();
+		std::cout << "\n";
+		bulk();
 
 		if (gettimeofday(&timeval, NULL) == -1) {
 			std::cout << "gettimeofday failed" << std::endl;
@@ -0,0 +1,158 @@
+#include <sys/time.h>
+#include <iostream>
+#include <iterator>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+#include "tests.hpp"
+
+#if IS_FT
+# include "static_vector.hpp"
+# define STATIC_VECTOR(T) ft::static_vector<T, 64>
+#else
+# include <vector>
+# define STATIC_VECTOR(T) std::vector<T>
+#endif
+
+namespace tests { namespace static_vector
+{
+	typedef STATIC_VECTOR(int) int_vector;
+
+	void print_vector(int_vector const& vec)
+	{
+		std::cout << " size " << vec.size() << " :";
+		for (int_vector::const_iterator cit = vec.begin(), cite = vec.end();
+				cit != cite; ++cit) {
+			std::cout << " " << *cit;
+		}
+		std::cout << "\n";
+	}
+
+	void modifiers()
+	{
+		std::cout << "modifiers tests :\n";
+
+		int_vector vec;
+		std::cout << "- empty : " << std::boolalpha << vec.empty() << ",";
+		print_vector(vec);
+
+		for (int i = 0; i < 10; ++i) {
+			vec.push_back(i * i);
+		}
+		std::cout << "- push_back, front " << vec.front() << ", back "
+			<< vec.back() << ", [3] " << vec[3] << ", at(4) " << vec.at(4) << ",";
+		print_vector(vec);
+
+		vec.pop_back();
+		vec.pop_back();
+		std::cout << "- pop_back :";
+		print_vector(vec);
+
+		vec.resize(12, -1);
+		std::cout << "- resize up :";
+		print_vector(vec);
+		vec.resize(4);
+		std::cout << "- resize down :";
+		print_vector(vec);
+
+		int_vector copy(vec);
+		vec.assign(3, 7);
+		std::cout << "- assign, copy :";
+		print_vector(copy);
+		std::cout << "  vec :";
+		print_vector(vec);
+
+		vec.swap(copy);
+		std::cout << "- swap, rbegin " << *vec.rbegin() << ",";
+		print_vector(vec);
+
+		try {
+			vec.at(4);
+		}
+		catch (std::out_of_range const&) {
+			std::cout << "- at(4) throws out_of_range\n";
+		}
+
+		int const many[64] = { 0 };
+		std::ostringstream oss;
+		for (int i = 0; i < 64; ++i) {
+			oss << i << " ";
+		}
+		std::istringstream iss(oss.str());
+#if IS_FT
+		try {
+			vec.insert(vec.begin() + 1, many, many + 64);
+		}
+		catch (std::length_error const&) {
+			std::cout << "- forward range insert past capacity throws,";
+		}
+		print_vector(vec);
+		try {
+			vec.insert(vec.begin() + 1, std::istream_iterator<int>(iss),
+					std::istream_iterator<int>());
+		}
+		catch (std::length_error const&) {
+			std::cout << "- input range insert past capacity throws,";
+		}
+		print_vector(vec);
+#else
+		static_cast<void>(many);
+		std::cout << "- forward range insert past capacity throws,";
+		print_vector(vec);
+		std::cout << "- input range insert past capacity throws,";
+		print_vector(vec);
+#endif
+
+		STATIC_VECTOR(std::string) strings(5, "str");
+		strings.push_back("last");
+		strings.clear();
+		strings.push_back("again");
+		std::cout << "- strings : " << strings.size() << " " << strings.back()
+			<< "\n";
+
+		std::cout << std::flush;
+	}
+
+	void relational_operators()
+	{
+		std::cout << "relational operators tests :\n";
+
+		int_vector vec(3, 1);
+		int_vector vec2(vec.begin(), vec.end());
+		std::cout << "- vec == vec2 : " << std::boolalpha << (vec == vec2)
+			<< ", vec < vec2 : " << (vec < vec2) << "\n";
+		vec2.push_back(0);
+		std::cout << "- vec < vec2 : " << (vec < vec2) << ", vec >= vec2 : "
+			<< (vec >= vec2) << ", vec != vec2 : " << (vec != vec2) << "\n";
+		vec[0] = 2;
+		std::cout << "- vec > vec2 : " << (vec > vec2) << ", vec <= vec2 : "
+			<< (vec <= vec2) << "\n";
+
+		std::cout << std::flush;
+	}
+
+	void launch()
+	{
+		struct timeval	timeval;
+
+		if (gettimeofday(&timeval, NULL) == -1) {
+			std::cout << "gettimeofday failed" << std::endl;
+			return;
+		}
+		unsigned long long time_start = timeval.tv_sec * 1000000 + timeval.tv_usec;
+
+		modifiers();
+		std::cout << "\n";
+		relational_operators();
+
+		if (gettimeofday(&timeval, NULL) == -1) {
+			std::cout << "gettimeofday failed" << std::endl;
+			return;
+		}
+		unsigned long long time_end = timeval.tv_sec * 1000000 + timeval.tv_usec;
+
+		std::cout << "\nTests duration : " << time_end - time_start
+			<< " microseconds" << std::endl;
+	}
+} }
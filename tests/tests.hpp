@@ -5,6 +5,13 @@
 #define NAMESPACE ft
 #endif
 
+// ft only containers are checked against their std equivalent
+#define TESTS_CONCAT_IMPL(a, b) a ## b
+#define TESTS_CONCAT(a, b) TESTS_CONCAT_IMPL(a, b)
+#define TESTS_IS_FT_ft 1
+#define TESTS_IS_FT_std 0
+#define IS_FT TESTS_CONCAT(TESTS_IS_FT_, NAMESPACE)
+
 namespace tests
 {
 	namespace list
@@ -31,6 +38,71 @@ namespace tests
 	{
 		void launch();
 	}
+
+	namespace btree_map
+	{
+		void launch();
+	}
+
+	namespace btree_set
+	{
+		void launch();
+	}
+
+	namespace flat_map
+	{
+		void launch();
+	}
+
+	namespace flat_set
+	{
+		void launch();
+	}
+
+	namespace sharded_map
+	{
+		void launch();
+	}
+
+	namespace persistent_map
+	{
+		void launch();
+	}
+
+	namespace unordered_map
+	{
+		void launch();
+	}
+
+	namespace unordered_set
+	{
+		void launch();
+	}
+
+	namespace multimap
+	{
+		void launch();
+	}
+
+	namespace multiset
+	{
+		void launch();
+	}
+
+	namespace interval_map
+	{
+		void launch();
+	}
+
+	namespace concurrent_stack
+	{
+		void launch();
+	}
+
+	namespace static_vector
+	{
+		void launch();
+	}
 }
 
 #endif
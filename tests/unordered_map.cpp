@@ -0,0 +1,227 @@
+#include <sys/time.h>
+#include <iostream>
+#include <string>
+
+#include "tests.hpp"
+
+#if IS_FT
+# include "unordered_map.hpp"
+# define UNORDERED_MAP ft::unordered_map
+#else
+# include <map>
+# define UNORDERED_MAP std::map
+#endif
+
+namespace tests { namespace unordered_map
+{
+	typedef UNORDERED_MAP<int, int> int_map;
+
+	int const nb_elems = 5000;
+
+	int shuffled_key(int i)
+	{
+		return (i * 7919) % nb_elems;
+	}
+
+	// Iteration order is unspecified, only order independent facts are
+	// printed.
+	void print_summary(int_map const& map)
+	{
+		long long key_sum = 0;
+		long long value_sum = 0;
+		int key_xor = 0;
+		int_map::size_type iterated = 0;
+		for (int_map::const_iterator cit = map.begin(), cite = map.end();
+				cit != cite; ++cit) {
+			key_sum += cit->first;
+			value_sum += cit->second;
+			key_xor ^= cit->first;
+			iterated++;
+		}
+		std::cout << " size " << map.size() << ", iterated " << iterated
+			<< ", key sum " << key_sum << ", value sum " << value_sum
+			<< ", key xor " << key_xor << "\n";
+	}
+
+	void constructors()
+	{
+		std::cout << "Constructors tests :\n";
+
+		int_map default_map;
+		std::cout << "- default constructor : empty " << std::boolalpha
+			<< default_map.empty() << ",";
+		print_summary(default_map);
+
+		int_map util;
+		for (int i = 0; i < nb_elems; ++i) {
+			util[shuffled_key(i)] = i;
+		}
+		int_map range(util.begin(), util.end());
+		std::cout << "- range constructor :";
+		print_summary(range);
+
+		int_map copy(util);
+		copy.erase(0);
+		std::cout << "- copy constructor :";
+		print_summary(copy);
+
+		copy = range;
+		std::cout << "- assignment operator :";
+		print_summary(copy);
+
+		std::cout << std::flush;
+	}
+
+	void modifiers()
+	{
+		std::cout << "modifiers tests :\n";
+
+		int_map map;
+		int inserted = 0;
+		for (int i = 0; i < nb_elems; ++i) {
+			inserted += map.insert(NAMESPACE::make_pair(shuffled_key(i) / 3, i))
+				.second;
+		}
+		std::cout << "- insert, inserted : " << inserted << ",";
+		print_summary(map);
+
+		for (int i = 0; i < nb_elems; i += 3) {
+			map[i] = -i;
+		}
+		std::cout << "- operator[] :";
+		print_summary(map);
+
+		int erased = 0;
+		for (int i = 0; i < nb_elems; i += 2) {
+			erased += map.erase(i);
+		}
+		std::cout << "- key erase, erased : " << erased << ",";
+		print_summary(map);
+
+		for (int i = 1; i < nb_elems; i += 4) {
+			int_map::iterator it = map.find(i);
+			if (it != map.end()) {
+				map.erase(it);
+			}
+		}
+		std::cout << "- iterator erase :";
+		print_summary(map);
+
+		for (int i = 0; i < nb_elems; ++i) {
+			map.insert(map.end(), NAMESPACE::make_pair(i + nb_elems, i));
+		}
+		std::cout << "- reinsert after erase :";
+		print_summary(map);
+
+		int_map other;
+		other[42] = 42;
+		map.swap(other);
+		std::cout << "- swap :";
+		print_summary(map);
+
+		other.clear();
+		std::cout << "- clear :";
+		print_summary(other);
+
+		std::cout << std::flush;
+	}
+
+	void lookup()
+	{
+		std::cout << "lookup tests :\n";
+
+		UNORDERED_MAP<std::string, int> map;
+		for (int i = 0; i < nb_elems; ++i) {
+			map[std::string(1, 'a' + i % 26) + std::string(i % 7, 'z')] += i;
+		}
+		std::cout << "- size : " << map.size() << ", count(\"bzz\") : "
+			<< map.count("bzz") << ", count(\"b\") : " << map.count("b")
+			<< ", find(\"mzzzz\") : " << map.find("mzzzz")->second
+			<< ", equal_range(\"q\") : " << map.equal_range("q").first->second
+			<< "\n";
+
+		std::cout << std::flush;
+	}
+
+	// The std emulation has no load factor, it only prints what the table
+	// is expected to hold.
+	void load_factor()
+	{
+		std::cout << "load factor tests :\n";
+
+		float const factors[] = { 0.05f, 0.1f, 0.25f, 0.5f };
+		for (int f = 0; f < 4; ++f) {
+			int_map map;
+#if IS_FT
+			map.max_load_factor(factors[f]);
+#endif
+			for (int i = 0; i < 100; ++i) {
+				map[i] = i;
+			}
+			for (int i = 0; i < 100; i += 3) {
+				map.erase(i);
+			}
+			for (int i = 0; i < 100; ++i) {
+				map[i + 100] = i;
+			}
+			bool under_limit = true;
+#if IS_FT
+			under_limit = map.load_factor() <= map.max_load_factor();
+#endif
+			std::cout << "- max load factor " << factors[f]
+				<< ", under limit " << std::boolalpha << under_limit << ",";
+			print_summary(map);
+		}
+
+		std::cout << std::flush;
+	}
+
+	void relational_operators()
+	{
+		std::cout << "relational operators tests :\n";
+
+		int_map lhs;
+		int_map rhs;
+		for (int i = 0; i < nb_elems; ++i) {
+			lhs[i] = i;
+			rhs[nb_elems - i - 1] = nb_elems - i - 1;
+		}
+		std::cout << "- equal maps : " << std::boolalpha << (lhs == rhs)
+			<< " " << (lhs != rhs) << "\n";
+		rhs[nb_elems / 2] = 0;
+		std::cout << "- different maps : " << std::boolalpha << (lhs == rhs)
+			<< " " << (lhs != rhs) << "\n";
+
+		std::cout << std::flush;
+	}
+
+	void launch()
+	{
+		struct timeval	timeval;
+
+		if (gettimeofday(&timeval, NULL) == -1) {
+			std::cout << "gettimeofday failed" << std::endl;
+			return;
+		}
+		unsigned long long time_start = timeval.tv_sec * 1000000 + timeval.tv_usec;
+
+		constructors();
+		std::cout << "\n";
+		modifiers();
+		std::cout << "\n";
+		lookup();
+		std::cout << "\n";
+		load_factor();
+		std::cout << "\n";
+		relational_operators();
+
+		if (gettimeofday(&timeval, NULL) == -1) {
+			std::cout << "gettimeofday failed" << std::endl;
+			return;
+		}
+		unsigned long long time_end = timeval.tv_sec * 1000000 + timeval.tv_usec;
+
+		std::cout << "\nTests duration : " << time_end - time_start
+			<< " microseconds" << std::endl;
+	}
+} }
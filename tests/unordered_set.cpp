@@ -0,0 +1,116 @@
+#include <sys/time.h>
+#include <iostream>
+#include <string>
+
+#include "tests.hpp"
+
+#if IS_FT
+# include "unordered_set.hpp"
+# define UNORDERED_SET ft::unordered_set
+#else
+# include <set>
+# define UNORDERED_SET std::set
+#endif
+
+namespace tests { namespace unordered_set
+{
+	typedef UNORDERED_SET<int> int_set;
+
+	int const nb_elems = 5000;
+
+	int shuffled_key(int i)
+	{
+		return (i * 7919) % nb_elems;
+	}
+
+	// Iteration order is unspecified, only order independent facts are
+	// printed.
+	void print_summary(int_set const& set)
+	{
+		long long sum = 0;
+		int key_xor = 0;
+		int_set::size_type iterated = 0;
+		for (int_set::const_iterator cit = set.begin(), cite = set.end();
+				cit != cite; ++cit) {
+			sum += *cit;
+			key_xor ^= *cit;
+			iterated++;
+		}
+		std::cout << " size " << set.size() << ", iterated " << iterated
+			<< ", sum " << sum << ", xor " << key_xor << "\n";
+	}
+
+	void modifiers()
+	{
+		std::cout << "modifiers tests :\n";
+
+		int_set set;
+		int inserted = 0;
+		for (int i = 0; i < nb_elems; ++i) {
+			inserted += set.insert(shuffled_key(i) / 3).second;
+		}
+		std::cout << "- insert, inserted : " << inserted << ",";
+		print_summary(set);
+
+		int_set copy(set);
+		int erased = 0;
+		for (int i = 0; i < nb_elems; i += 2) {
+			erased += set.erase(i);
+		}
+		std::cout << "- key erase, erased : " << erased << ",";
+		print_summary(set);
+		std::cout << "- copy :";
+		print_summary(copy);
+
+		set.erase(set.find(1));
+		set.erase(set.begin(), set.end());
+		std::cout << "- iterator and range erase :";
+		print_summary(set);
+
+		set.insert(copy.begin(), copy.end());
+		std::cout << "- range insert, (set == copy) : " << std::boolalpha
+			<< (set == copy) << ",";
+		print_summary(set);
+
+		std::cout << std::flush;
+	}
+
+	void lookup()
+	{
+		std::cout << "lookup tests :\n";
+
+		UNORDERED_SET<std::string> set;
+		for (int i = 0; i < nb_elems; ++i) {
+			set.insert(std::string(1, 'a' + i % 26) + std::string(i % 7, 'z'));
+		}
+		std::cout << "- size : " << set.size() << ", count(\"bzz\") : "
+			<< set.count("bzz") << ", count(\"b\") : " << set.count("b")
+			<< ", find(\"mzzzz\") : " << *set.find("mzzzz") << "\n";
+
+		std::cout << std::flush;
+	}
+
+	void launch()
+	{
+		struct timeval	timeval;
+
+		if (gettimeofday(&timeval, NULL) == -1) {
+			std::cout << "gettimeofday failed" << std::endl;
+			return;
+		}
+		unsigned long long time_start = timeval.tv_sec * 1000000 + timeval.tv_usec;
+
+		modifiers();
+		std::cout << "\n";
+		lookup();
+
+		if (gettimeofday(&timeval, NULL) == -1) {
+			std::cout << "gettimeofday failed" << std::endl;
+			return;
+		}
+		unsigned long long time_end = timeval.tv_sec * 1000000 + timeval.tv_usec;
+
+		std::cout << "\nTests duration : " << time_end - time_start
+			<< " microseconds" << std::endl;
+	}
+} }
@@ -1,6 +1,7 @@
 #include <sys/time.h>
 #include <climits>
 #include <vector>
+#include <string>
 
 #include "vector.hpp"
 
@@ -70,6 +71,26 @@ namespace tests { namespace vector
 		}
 		std::cout << "\n";
 
+		int const array[] = { 7, 8, 9 };
+		NAMESPACE::vector<int> pointers(array, array + 3);
+		NAMESPACE::vector<int> reversed(util.rbegin(), util.rend());
+		std::cout << "- range constructor from pointers and reverse iterators,"
+			" values :";
+		for (NAMESPACE::vector<int>::const_iterator cit = pointers.begin(),
+				cite = pointers.end(); cit != cite; ++cit) {
+			std::cout << " " << *cit;
+		}
+		for (NAMESPACE::vector<int>::const_iterator cit = reversed.begin(),
+				cite = reversed.end(); cit != cite; ++cit) {
+			std::cout << " " << *cit;
+		}
+		std::cout << "\n";
+
+		NAMESPACE::vector<char> chars(5, 'a');
+		chars.insert(chars.begin() + 2, 3, 'b');
+		std::cout << "- char fill constructor and insert, values : "
+			<< std::string(chars.begin(), chars.end()) << "\n";
+
 		std::cout << std::flush;
 	}
 
@@ -597,6 +618,68 @@ namespace tests { namespace vector
 		std::cout << std::flush;
 	}
 
+	static long counting_live = 0;
+
+	template <class T>
+	struct counting_allocator : std::allocator<T>
+	{
+		template <class U>
+		struct rebind
+		{
+			typedef counting_allocator<U> other;
+		};
+
+		counting_allocator()
+		{
+			return;
+		}
+
+		template <class U>
+		counting_allocator(counting_allocator<U> const&)
+		{
+			return;
+		}
+
+		void construct(T* p, T const& val)
+		{
+			std::allocator<T>::construct(p, val);
+			++counting_live;
+			return;
+		}
+
+		void destroy(T* p)
+		{
+			std::allocator<T>::destroy(p);
+			--counting_live;
+			return;
+		}
+	};
+
+	void user_allocator()
+	{
+		std::cout << "user allocator tests :\n";
+
+		int arr[] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+		{
+			NAMESPACE::vector<int, counting_allocator<int> > vec(arr, arr + 8);
+			std::cout << "- range constructor, live : " << counting_live
+				<< "\n";
+			vec.insert(vec.begin() + 2, arr, arr + 8);
+			vec.insert(vec.begin(), 20, 42);
+			std::cout << "- insert, live == size() : " << std::boolalpha
+				<< (counting_live == static_cast<long>(vec.size())) << "\n";
+			vec.erase(vec.begin() + 3, vec.begin() + 10);
+			std::cout << "- erase, live == size() : "
+				<< (counting_live == static_cast<long>(vec.size())) << "\n";
+			NAMESPACE::vector<char, counting_allocator<char> > chars(10, 'a');
+			std::cout << "- fill constructor, live : " << counting_live
+				- static_cast<long>(vec.size()) << "\n";
+		}
+		std::cout << "- destructors, live : " << counting_live << "\n";
+
+		std::cout << std::flush;
+	}
+
 	static void print_vectors_comparaison(NAMESPACE::vector<int> const& vec,
 			NAMESPACE::vector<int> const& vec2)
 	{
@@ -637,6 +720,28 @@ namespace tests { namespace vector
 		vec.back() = 0;
 		print_vectors_comparaison(vec, vec2);
 
+		std::cout << "\n";
+		NAMESPACE::vector<int> ints(100, 7);
+		NAMESPACE::vector<int> ints2(ints);
+		ints2[42] = -1;
+		NAMESPACE::vector<char> chars(1000, 'a');
+		NAMESPACE::vector<char> chars2(chars);
+		chars2[999] = -100;
+		NAMESPACE::vector<unsigned char> bytes(1000, 200);
+		NAMESPACE::vector<unsigned char> bytes2(999, 200);
+		std::cout << "- ints == ints2 : " << (ints == ints2)
+			<< ", ints < ints2 : " << (ints < ints2)
+			<< ", ints2 < ints : " << (ints2 < ints) << "\n";
+		std::cout << "- chars == chars2 : " << (chars == chars2)
+			<< ", chars < chars2 : " << (chars < chars2)
+			<< ", chars2 < chars : " << (chars2 < chars) << "\n";
+		std::cout << "- bytes == bytes2 : " << (bytes == bytes2)
+			<< ", bytes < bytes2 : " << (bytes < bytes2)
+			<< ", bytes2 < bytes : " << (bytes2 < bytes) << "\n";
+		bytes2.push_back(201);
+		std::cout << "- bytes < bytes2 : " << (bytes < bytes2)
+			<< ", bytes2 <= bytes : " << (bytes2 <= bytes) << "\n";
+
 		std::cout << std::flush;
 	}
 
@@ -700,6 +805,8 @@ namespace tests { namespace vector
 		std::cout << "\n";
 		get_allocator();
 		std::cout << "\n";
+		user_allocator();
+		std::cout << "\n";
 		relational_operators();
 
 		if (gettimeofday(&timeval, NULL) == -1) {